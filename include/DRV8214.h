@@ -11,10 +11,25 @@
 
 #include "drv8214_platform_config.h" // For platform detection
 #include "drv8214_platform_i2c.h"    // For abstracted I2C functions
+#include "drv8214_bus.h"             // For the compile-time bus policy
+#include "drv8214_async.h"           // For the asynchronous transfer queue
+#include "drv8214_platform_time.h"   // For abstracted time functions
+#include "drv8214_log.h"             // For the compile-time logging policy
+#include "drv8214_field.h"           // For the typed register fields
+#include "drv8214_convert.h"         // For the raw status to engineering unit conversions
+#include "drv8214_latency.h"         // For the per-method latency histograms
 
 // /*! @name To define success code */
 #define DRV8214_OK           0
 
+// /*! @name To define error codes */
+#define DRV8214_ERR_TIMEOUT  1  // Operation did not complete within its time budget
+#define DRV8214_ERR_FAULT    2  // Device reported a fault (OCP, OVP, TSD) that aborted the operation
+#define DRV8214_ERR_LIMIT    3  // Move refused because it would exceed a soft travel limit
+#define DRV8214_ERR_INVALID  4  // Invalid argument or configuration
+#define DRV8214_ERR_BUSY     5  // Asynchronous request still in flight, or transfer queue full
+#define DRV8214_ERR_BUS      6  // I2C transfer failed
+
 // I2C Address (depends on A0, A1 pin settings)
 #define DRV8214_I2C_ADDR_00  0x30  // = 0x60/0x61 in 8-bit  -   A1 = 0, A0 = 0 
 #define DRV8214_I2C_ADDR_0Z  0x31  // = 0x62/0x63 in 8-bit  -   A1 = 0, A0 = High-Z
@@ -54,6 +69,11 @@
 #define DRV8214_RC_CTRL7     0x18  // Ripple Count Control 7: Proportional gain divisor for control loop
 #define DRV8214_RC_CTRL8     0x19  // Ripple Count Control 8: Integral gain divisor for control loop
 
+#define DRV8214_CONFIG_COUNT 17    // CONFIG0 to RC_CTRL8, the registers cached in the shadow image
+#ifndef DRV8214_SCRUB_BURST
+    #define DRV8214_SCRUB_BURST 4  // Registers compared by each scrubber read
+#endif
+
 // --- BIT MASKS FOR CONTROL REGISTERS ---
 
 // FAULT REGISTER (0x00) - Read Only
@@ -140,6 +160,60 @@
 #define RC_CTRL8_KI_DIV       0xE0  // Bits 7-5 - Integral Gain Divisor for Control Loop [2:0]
 #define RC_CTRL8_KI           0x1F  // Bits 4-0 - Integral Gain Value [4:0]
 
+// --- RESET VALUES ---
+#define DRV8214_REG_COUNT     0x1A  // FAULT (0x00) to RC_CTRL8 (0x19)
+
+// Power-on reset value of every register, FAULT reports NPOR after a reset. 0x07 and 0x08 are reserved and read 0.
+constexpr uint8_t DRV8214_RESET_VALUES[DRV8214_REG_COUNT] = {
+    FAULT_NPOR, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x00 - 0x08: status and reserved
+    CONFIG0_EN_OVP | CONFIG0_EN_STALL, // CONFIG0
+    0xFF, // CONFIG1
+    0x0F, // CONFIG2
+    0x00, // CONFIG3
+    0x00, // CONFIG4
+    0x00, // REG_CTRL0
+    0xFF, // REG_CTRL1
+    0x00, // REG_CTRL2
+    0x00, // RC_CTRL0
+    0xFF, // RC_CTRL1
+    0x00, // RC_CTRL2
+    0x00, // RC_CTRL3
+    0x00, // RC_CTRL4
+    0x00, // RC_CTRL5
+    0x00, // RC_CTRL6
+    0x00, // RC_CTRL7
+    0x00  // RC_CTRL8
+};
+
+constexpr uint8_t drv8214_reset_value(uint8_t reg) {
+    return (reg < DRV8214_REG_COUNT) ? DRV8214_RESET_VALUES[reg] : 0;
+}
+
+static_assert(DRV8214_CONFIG0 + DRV8214_CONFIG_COUNT == DRV8214_REG_COUNT, "The shadow image must end with the register map");
+static_assert(drv8214_reset_value(DRV8214_CONFIG0) == 0x60, "CONFIG0 resets with EN_OVP and EN_STALL set");
+
+// --- REGISTER FIELDS ---
+// Every named bit field of the masks above. FIELD_<REG>_<NAME> is the typed field, see drv8214_field.h.
+#define DRV8214_FIELDS(X) \
+    X(FAULT, FAULT) X(FAULT, STALL) X(FAULT, OCP) X(FAULT, OVP) X(FAULT, TSD) X(FAULT, NPOR) X(FAULT, CNT_DONE) \
+    X(REG_STATUS3, IN_DUTY) \
+    X(CONFIG0, EN_OUT) X(CONFIG0, EN_OVP) X(CONFIG0, EN_STALL) X(CONFIG0, VSNS_SEL) X(CONFIG0, VM_GAIN_SEL) \
+    X(CONFIG0, CLR_CNT) X(CONFIG0, CLR_FLT) X(CONFIG0, DUTY_CTRL) \
+    X(CONFIG3, IMODE) X(CONFIG3, SMODE) X(CONFIG3, INT_VREF) X(CONFIG3, TBLANK) X(CONFIG3, TDEG) X(CONFIG3, OCP_MODE) X(CONFIG3, TSD_MODE) \
+    X(CONFIG4, RC_REP) X(CONFIG4, STALL_REP) X(CONFIG4, CBC_REP) X(CONFIG4, PMODE) X(CONFIG4, I2C_BC) X(CONFIG4, I2C_EN_IN1) X(CONFIG4, I2C_PH_IN2) \
+    X(REG_CTRL0, EN_SS) X(REG_CTRL0, REG_CTRL) X(REG_CTRL0, PWM_FREQ) X(REG_CTRL0, W_SCALE) \
+    X(REG_CTRL2, OUT_FLT) X(REG_CTRL2, EXT_DUTY) \
+    X(RC_CTRL0, EN_RC) X(RC_CTRL0, DIS_EC) X(RC_CTRL0, RC_HIZ) X(RC_CTRL0, FLT_GAIN_SEL) X(RC_CTRL0, CS_GAIN_SEL) \
+    X(RC_CTRL2, INV_R_SCALE) X(RC_CTRL2, KMC_SCALE) X(RC_CTRL2, RC_THR_SCALE) X(RC_CTRL2, RC_THR_HIGH) \
+    X(RC_CTRL5, FLT_K) \
+    X(RC_CTRL6, EC_PULSE_DIS) X(RC_CTRL6, T_MECH_FLT) X(RC_CTRL6, EC_FALSE_PER) X(RC_CTRL6, EC_MISS_PER) \
+    X(RC_CTRL7, KP_DIV) X(RC_CTRL7, KP) \
+    X(RC_CTRL8, KI_DIV) X(RC_CTRL8, KI)
+
+#define DRV8214_FIELD_TYPEDEF(reg, name) typedef DRV8214_FIELD(reg, name) FIELD_##reg##_##name;
+DRV8214_FIELDS(DRV8214_FIELD_TYPEDEF)
+#undef DRV8214_FIELD_TYPEDEF
+
 enum ControlMode { PWM, PH_EN };
 enum RegulationMode { CURRENT_FIXED, CURRENT_CYCLES, SPEED, VOLTAGE };
 // when using I2C control, the speed/voltage cannot be controlled if using the CURRENT_FIXED or CURRENT_CYCLES regulation mode
@@ -170,41 +244,227 @@ struct DRV8214_Config {
     uint8_t ripple_threshold_scale = 2;  // Ripple count threshold scaling factor
 };
 
+// Raw snapshot of the status registers FAULT to REG_STATUS3, read in a single burst
+struct DRV8214_Status {
+    uint8_t  fault;          // FAULT register
+    uint8_t  speed;          // RC_STATUS1, estimated motor speed
+    uint16_t ripple_count;   // RC_STATUS3:RC_STATUS2, ripple counter
+    uint8_t  voltage;        // REG_STATUS1, voltage across the motor terminals
+    uint8_t  current;        // REG_STATUS2, current flowing through the motor
+    uint8_t  duty;           // REG_STATUS3, bridge duty cycle (6-bit)
+};
+
+struct DRV8214_HomingConfig {
+    bool     direction = false;          // Direction towards the hard stop (true: forward, false: reverse)
+    uint16_t speed = 0;                  // Approach speed in RPM (SPEED regulation)
+    float    voltage = 0.0f;             // Approach voltage in V (VOLTAGE regulation)
+    float    stall_current = 0.25f;      // Reduced regulation and stall current limit used while homing in A
+    uint16_t backoff_ripples = 100;      // Number of ripples to back off from the hard stop
+    uint32_t timeout_ms = 10000;         // Maximum time allowed to reach the hard stop
+    uint32_t backoff_timeout_ms = 2000;  // Maximum time allowed for the back off move
+    uint16_t poll_interval_ms = 2;       // Interval between two fault checks
+    bool (*nfault_asserted)(uint8_t driver_id) = nullptr; // Optional nFAULT pin reader, the FAULT register is then only read once nFAULT is low
+};
+
+struct DRV8214_HomingResult {
+    uint8_t  status;                     // DRV8214_OK or error code
+    uint32_t time_to_stop_ms;            // Time spent driving to the hard stop
+    uint32_t total_time_ms;              // Time spent in the whole homing routine
+    uint16_t ripples_to_stop;            // Ripples counted while driving to the hard stop
+};
+
+struct DRV8214_BacklashCalibration {
+    bool     output_locked = true;       // Output shaft held in place: measured stall to stall. Otherwise detected from the load current rise.
+    bool     direction = true;           // Direction of the first take-up move (true: forward, false: reverse)
+    uint16_t speed = 0;                  // Calibration speed in RPM (SPEED regulation)
+    float    voltage = 0.0f;             // Calibration voltage in V (VOLTAGE regulation)
+    float    stall_current = 0.25f;      // Regulation and stall current limit used during the calibration in A
+    float    engage_current = 0.1f;      // Current above which the gearbox flank is considered engaged in A (output_locked = false)
+    uint16_t ignore_ripples = 2;         // Ripples ignored after starting, covers the inrush current (output_locked = false)
+    uint16_t takeup_ripples = 100;       // Travel of the slack take-up move, a few times the expected backlash (output_locked = false)
+    uint16_t max_ripples = 2000;         // Travel of the measured move after which the calibration is aborted
+    uint32_t timeout_ms = 5000;          // Maximum time allowed per calibration move
+    uint16_t poll_interval_ms = 1;       // Interval between two checks
+};
+
+struct DRV8214_RippleCalibration {
+    bool   (*index_reached)(uint8_t driver_id) = nullptr; // Index sensor on the output shaft, true while the mark is seen. nullptr: stall-to-stall traverse
+    uint16_t index_revolutions = 10;     // Output shaft revolutions measured between index marks (index mode)
+    float    traverse_revolutions = 0.0f; // Known travel between the two hard stops in output shaft revolutions (stall-to-stall mode)
+    bool     direction = true;           // Direction of the measured move (true: forward, false: reverse)
+    uint16_t speed = 0;                  // Calibration speed in RPM (SPEED regulation)
+    float    voltage = 0.0f;             // Calibration voltage in V (VOLTAGE regulation)
+    float    stall_current = 0.25f;      // Regulation current in A (CURRENT regulation, both modes), also the stall limit in stall-to-stall mode
+    uint32_t timeout_ms = 30000;         // Maximum time allowed per calibration move
+    uint16_t poll_interval_ms = 5;       // Interval between two ripple counter reads, must stay below 65535 ripples of travel
+};
+
 class DRV8214 {
 
     private:
+        // Register access, dispatched at compile time to the selected bus policy
+        typedef DRV8214_RegisterAccess<DRV8214_BUS_POLICY> Bus;
+
+        // Members are grouped by alignment, widest first, so that an instance carries no padding. The configuration
+        // lives in the shadow image only: settings are decoded from it, DRV8214_Config is not kept after init().
+        #ifdef DRV8214_PLATFORM_ARDUINO
+            // Debug port used for printing messages
+            Stream* _debugPort = nullptr;
+        #endif
+
+        // Odometry, soft travel limits and backlash compensation
+        int32_t  position = 0;              // Absolute position in ripples
+        int32_t  soft_limit_min = 0;        // Lowest allowed output shaft position in ripples (getOutputPosition())
+        int32_t  soft_limit_max = 0;        // Highest allowed output shaft position in ripples
+        int32_t  backlash_offset = 0;       // Motor ripples spent crossing the backlash band, position minus output position
+        float    ripples_per_shaft_revolution; // Ripples per output shaft revolution, fractional once calibrated
+
+        uint16_t last_ripple_count = 0;     // Ripple counter value already accounted in position
+        uint16_t backlash_ripples = 0;      // Lost motion between the two gearbox flanks in ripples
+
         // Hardware and driver-specific settings
-        uint8_t  address;                   // I2C address of the driver (depends on A0, A1 pin settings, 9 possible addresses)
-        uint8_t  driver_ID;                 // ID of the driver if multiple drivers are used
         uint16_t Ripropri;                  // Value in Ohms of the resistor connected to IPROPI pin
         uint16_t ripples_per_revolution;    // Number of ripples per revolution
-        uint8_t  motor_internal_resistance; // Internal resistance of the motor in Ohms
-        uint8_t  motor_reduction_ratio;     // Reduction ratio of the motor
         uint16_t motor_max_rpm;             // Maximum RPM of the motor
+        uint16_t vref_mv = 500;             // Current regulation reference in mV, internal (500 mV) or external
 
-        // Configuration settings, all in a single struct
-        DRV8214_Config config;
+        // Error and recovery counters
+        uint16_t bus_errors = 0;            // Failed register accesses since construction
+        uint16_t npor_events = 0;           // Power-on resets detected and recovered since init()
+        uint16_t scrub_repairs = 0;         // Registers found drifted and rewritten by the scrubber
 
-        #ifdef DRV8214_PLATFORM_ARDUINO
-            // Debug port used for printing messages
-            Stream* _debugPort = nullptr;
+        // Shadow image of CONFIG0 to RC_CTRL8: the last value written to each register (self-clearing bits excluded)
+        uint8_t  shadow[DRV8214_CONFIG_COUNT];
+
+        // Asynchronous status request
+        enum AsyncState : uint8_t { ASYNC_IDLE, ASYNC_PENDING, ASYNC_READY, ASYNC_FAILED };
+        uint8_t  async_status_raw[7];       // FAULT to REG_STATUS3, filled by the transfer
+        volatile uint8_t async_status_state = ASYNC_IDLE;
+
+        uint8_t  address;                   // I2C address of the driver (depends on A0, A1 pin settings, 9 possible addresses)
+        uint8_t  driver_ID;                 // ID of the driver if multiple drivers are used
+        uint8_t  motor_internal_resistance; // Internal resistance of the motor in Ohms
+        uint8_t  motor_reduction_ratio;     // Reduction ratio of the motor
+        int8_t   motion_direction = 1;      // Direction of the last commanded motion (1: forward, -1: reverse)
+        int8_t   backlash_side = 0;         // Gearbox flank currently engaged (1: forward, -1: reverse, 0: unknown)
+        uint8_t  scrub_cursor = 0;          // Next register checked by the scrubber, offset from CONFIG0
+        #if DRV8214_LATENCY
+            uint8_t latency_slots[DRV8214_LATENCY_APIS] = {}; // Histogram of each method for this driver, index + 1, 0 until its first call
+            uint8_t latency_depth = 0;                         // Timed calls in progress, only the outermost one is recorded
         #endif
+        uint8_t  last_error = DRV8214_OK;   // DRV8214_ERR_BUS once an access failed, cleared by getLastError()
+        uint8_t  last_bus_result = DRV8214_I2C_OK; // DRV8214_I2C_* result of the last failed access
+
+        bool     shadow_valid = false;      // Seeded from the device by init()
+        bool     dry_run = false;           // Register accesses only update the shadow image, no bus traffic
+        bool     verbose = false;           // Log output enabled, from DRV8214_Config
+        bool     soft_limits_enabled = false; // Moves are checked against soft_limit_min/max
+        bool     soft_limit_clip = true;      // Clip moves at the limit instead of refusing them
+        bool     soft_limit_armed = false;    // Hardware ripple threshold currently set to stop at the limit
+        bool     soft_limit_saved = false;    // soft_limit_saved_regs hold the RC_HIZ and threshold the limits overrode
+        uint8_t  soft_limit_saved_regs[3];    // RC_CTRL0 to RC_CTRL2 before the first limit-derived threshold, restored when the move ends
+
+        // Settings changed by the stall-based sequences (homing, calibration) and restored when they end
+        struct SavedState {
+            uint8_t config0;
+            uint8_t config3;
+            uint8_t config4;
+            uint8_t rc_ctrl0;
+            uint8_t rc_ctrl1;
+            uint8_t rc_ctrl2;
+            bool soft_limits_enabled;
+        };
+
+        // Configuration field decoded from the shadow image
+        template <typename Field>
+        uint8_t shadowField() const {
+            static_assert(Field::reg >= DRV8214_CONFIG0 && Field::reg <= DRV8214_RC_CTRL8, "Only configuration registers are cached");
+            return Field::decode(shadow[Field::reg - DRV8214_CONFIG0]);
+        }
+        ControlMode    controlMode() const    { return shadowField<FIELD_CONFIG4_PMODE>() ? PWM : PH_EN; }
+        RegulationMode regulationMode() const { return (RegulationMode)shadowField<FIELD_REG_CTRL0_REG_CTRL>(); }
+        uint8_t        wScale() const         { return (uint8_t)(16 << shadowField<FIELD_REG_CTRL0_W_SCALE>()); } // rad/s per WSET_VSET step
+        uint16_t       maxCurrentmA() const;  // Full scale of REG_STATUS2, set by CS_GAIN_SEL
+
+        // Register access, failures are recorded in last_error
+        uint8_t busResult(uint8_t i2c_result);
+        uint8_t busStatus(uint16_t errors_before);
+        uint8_t regRead(uint8_t reg);
+        uint8_t regWrite(uint8_t reg, uint8_t value);
+        uint8_t regReadBurst(uint8_t reg, uint8_t* data, uint8_t length);
+        uint8_t regWriteBurst(uint8_t reg, const uint8_t* data, uint8_t length);
+        uint8_t regModifyBits(uint8_t reg, uint8_t mask, uint8_t new_value);
+
+        // Field update as a single write built from the shadow image, read-modify-write until the image is valid
+        template <uint8_t Reg>
+        uint8_t writeFields(const DRV8214_FieldSet<Reg>& fields) {
+            static_assert(Reg >= DRV8214_CONFIG0 && Reg <= DRV8214_RC_CTRL8, "Only configuration registers are writable");
+            if (!shadow_valid) { return regModifyBits(Reg, fields.mask, fields.value); }
+            return regWrite(Reg, fields.apply(shadow[Reg - DRV8214_CONFIG0]));
+        }
+        void    shadowStore(uint8_t reg, const uint8_t* data, uint8_t length);
+        void    shadowLoad(uint8_t reg, uint8_t* data, uint8_t length);
+        uint8_t handlePowerOnReset();
+        void    logDriftedFields(uint8_t reg, uint8_t actual, uint8_t expected);
 
         // Private functions
         void drvPrint(const char* message);
+        static void printLine(const char* line, void* context);
+        static void decodeStatus(const uint8_t* raw, DRV8214_Status& status);
+        static void onStatusTransfer(const DRV8214_AsyncOp& op, uint8_t result, void* context);
+        #if DRV8214_LOG_MODE == DRV8214_LOG_TEXT
+            void drvPrintf(const char* format, ...);
+        #endif
+        void applyConfiguration(const DRV8214_Config& config);
+        void dryRunConfiguration(const DRV8214_Config& config);
+        uint8_t writeImageChanges(const uint8_t* base);
+        int8_t driveDirection(uint8_t config4);
+        void setMotionDirection(int8_t direction);
+        uint8_t traverseToStall(bool direction, uint16_t speed, float voltage, float current, uint32_t timeout_ms, uint16_t poll_interval_ms);
+        uint8_t waitForFault(uint8_t fault_mask, uint32_t timeout_ms, uint16_t poll_interval_ms, bool (*nfault_asserted)(uint8_t));
+        int32_t softLimitRoom(bool direction); // Motor ripples left before the output shaft reaches the limit
+        uint8_t armSoftLimit(bool direction);
+        void saveSoftLimitState();
+        void releaseSoftLimit();
+        uint8_t driveForward(uint16_t speed, float voltage, float requested_current);
+        uint8_t driveReverse(uint16_t speed, float voltage, float requested_current);
+        uint8_t drive(bool direction, uint16_t speed, float voltage, float requested_current);
+        void engageBacklash(bool direction);
+        void beginStallSequence(SavedState& saved, float stall_current);
+        void endStallSequence(const SavedState& saved);
 
     public:
         // Constructor
-        DRV8214(uint8_t addr, uint8_t id, uint16_t sense_resistor, uint8_t ripples, uint8_t rm, uint8_t reduction_ratio, uint16_t rpm) : address(addr), driver_ID(id), Ripropri(sense_resistor), ripples_per_revolution(ripples), motor_internal_resistance(rm), motor_reduction_ratio(reduction_ratio), motor_max_rpm(rpm) {}
+        DRV8214(uint8_t addr, uint8_t id, uint16_t sense_resistor, uint16_t ripples, uint8_t rm, uint8_t reduction_ratio, uint16_t rpm) : ripples_per_shaft_revolution((float)ripples * reduction_ratio), Ripropri(sense_resistor), ripples_per_revolution(ripples), motor_max_rpm(rpm), address(addr), driver_ID(id), motor_internal_resistance(rm), motor_reduction_ratio(reduction_ratio) {
+            for (uint8_t i = 0; i < DRV8214_CONFIG_COUNT; i++) { shadow[i] = DRV8214_RESET_VALUES[DRV8214_CONFIG0 + i]; } // Device state until init()
+        }
     
         // Initialization
         uint8_t init(const DRV8214_Config& config);
 
+        // --- Recovery Functions ---
+        uint8_t restoreConfiguration(bool clear_faults = false); // Rewrite the shadow image to the device
+        uint8_t getShadowRegister(uint8_t reg);  // Cached value of a configuration register
+        uint8_t readRegisters(uint8_t* image);   // Every register, FAULT to RC_CTRL8, in one burst of DRV8214_REG_COUNT bytes
+        void    getExpectedImage(uint8_t* image); // Register image the device should hold: reset values for status, shadow for configuration
+        static uint8_t serviceBus(DRV8214* const* drivers, uint8_t count); // Recover a stuck bus and restore every driver
+        uint16_t getPowerOnResetCount();         // Power-on resets detected by the status polls since init()
+        uint8_t  scrubConfiguration(uint32_t budget_us); // Compare the next registers with the shadow image and repair them
+        uint16_t getScrubRepairCount();          // Registers repaired by the scrubber since init()
+
+        // --- Error Functions ---
+        uint8_t  getLastError();                 // DRV8214_ERR_BUS if a register access failed since the last call, then cleared
+        uint8_t  getLastBusResult();             // DRV8214_I2C_* result of the last failed access
+
         // --- Helper Functions ---
         uint8_t  getDriverAdress();
         uint8_t  getDriverID();
         uint8_t  getSenseResistor();
-        uint8_t  getRipplesPerRevolution();
+        uint16_t getRipplesPerRevolution();
+        float    getRipplesPerShaftRevolution();
+        void     setRipplesPerShaftRevolution(float ripples);
+        uint8_t  getMotorInternalResistance();
+        uint8_t  getMotorReductionRatio();
         uint8_t  getFaultStatus();
         uint32_t getMotorSpeedRPM();
         uint16_t getMotorSpeedRAD();
@@ -236,64 +496,97 @@ class DRV8214 {
         uint8_t  getRC_CTRL6();
         uint8_t  getRC_CTRL7();
         uint8_t  getRC_CTRL8();
+        uint8_t  readStatus(DRV8214_Status& status);
+        float    convertMotorVoltage(uint8_t voltage_register);
+        float    convertMotorCurrent(uint8_t current_register);
+        uint8_t  convertDutyCycle(uint8_t duty_register);
+        void     getUnitScales(DRV8214_UnitScales& scales); // Per-driver scales of the batch conversions of drv8214_convert.h
 
         // --- Configuration Functions ---
-        void enableHbridge();
-        void disableHbridge();
-        void setStallDetection(bool stall_en);
-        void setVoltageRange(bool range);
-        void setOvervoltageProtection(bool OVP);
-        void resetRippleCounter();
-        void resetFaultFlags();
-        void enableDutyCycleControl();
-        void disableDutyCycleControl();
-        void setInrushDuration(uint16_t inrush_dur);
-        void setCurrentRegMode(uint8_t mode);
-        void setStallBehavior(bool behavior);
-        void setInternalVoltageReference(float reference_voltage);
-        void configureConfig3(uint8_t config3);
-        void setI2CControl(bool I2CControl);
-        void enablePWMControl();
-        void enablePHENControl();
-        void enableStallInterrupt();
-        void disableStallInterrupt();
-        void enableCountThresholdInterrupt();
-        void disableCountThresholdInterrupt();
-        void setBridgeBehaviorThresholdReached(bool stops);
-        void setSoftStartStop(bool enable);
-        void configureControl0(uint8_t control0);
-        void setRippleSpeed(uint16_t speed);
-        void setVoltageSpeed(float voltage);
-        void setRegulationAndStallCurrent(float requested_current);
-        void configureControl2(uint8_t control2);
-        void enableRippleCount(bool enable = true);
-        void enableErrorCorrection(bool enable = true);
-        void configureRippleCount0(uint8_t ripple0);
-        void setRippleCountThreshold(uint16_t threshold);
-        void setRippleThresholdScale(uint8_t scale);
-        void setKMCScale(uint8_t scale);
-        void setMotorInverseResistance(uint8_t resistance);
-        void setMotorInverseResistanceScale(uint8_t scale);
-        void setResistanceRelatedParameters();
-        void setKMC(uint8_t factor);
-        void setFilterDamping(uint8_t damping);
-        void configureRippleCount6(uint8_t ripple6);
-        void configureRippleCount7(uint8_t ripple7);
-        void configureRippleCount8(uint8_t ripple8);
+        uint8_t enableHbridge();
+        uint8_t disableHbridge();
+        uint8_t setStallDetection(bool stall_en);
+        uint8_t setVoltageRange(bool range);
+        uint8_t setOvervoltageProtection(bool OVP);
+        uint8_t resetRippleCounter();
+        uint8_t resetFaultFlags();
+        uint8_t enableDutyCycleControl();
+        uint8_t disableDutyCycleControl();
+        uint8_t setInrushDuration(uint16_t inrush_dur);
+        uint8_t setCurrentRegMode(uint8_t mode);
+        uint8_t setStallBehavior(bool behavior);
+        uint8_t setInternalVoltageReference(float reference_voltage);
+        uint8_t configureConfig3(uint8_t config3);
+        uint8_t setI2CControl(bool I2CControl);
+        uint8_t enablePWMControl();
+        uint8_t enablePHENControl();
+        uint8_t enableStallInterrupt();
+        uint8_t disableStallInterrupt();
+        uint8_t enableCountThresholdInterrupt();
+        uint8_t disableCountThresholdInterrupt();
+        uint8_t setBridgeBehaviorThresholdReached(bool stops);
+        uint8_t setSoftStartStop(bool enable);
+        uint8_t configureControl0(uint8_t control0);
+        uint8_t setRippleSpeed(uint16_t speed);
+        uint8_t setVoltageSpeed(float voltage);
+        uint8_t setRegulationAndStallCurrent(float requested_current);
+        uint8_t configureControl2(uint8_t control2);
+        uint8_t enableRippleCount(bool enable = true);
+        uint8_t enableErrorCorrection(bool enable = true);
+        uint8_t configureRippleCount0(uint8_t ripple0);
+        uint8_t setRippleCountThreshold(uint16_t threshold);
+        uint8_t setRippleThresholdScale(uint8_t scale);
+        uint8_t setKMCScale(uint8_t scale);
+        uint8_t setMotorInverseResistance(uint8_t resistance);
+        uint8_t setMotorInverseResistanceScale(uint8_t scale);
+        uint8_t setResistanceRelatedParameters();
+        uint8_t setKMC(uint8_t factor);
+        uint8_t setFilterDamping(uint8_t damping);
+        uint8_t configureRippleCount6(uint8_t ripple6);
+        uint8_t configureRippleCount7(uint8_t ripple7);
+        uint8_t configureRippleCount8(uint8_t ripple8);
 
         // --- Motor Control Functions ---
-        void setControlMode(ControlMode mode, bool I2CControl);
-        void setRegulationMode(RegulationMode regulation);
-        void turnForward(uint16_t speed = 0, float voltage = 0, float requested_current = 0);
-        void turnReverse(uint16_t speed = 0, float voltage = 0, float requested_current = 0);
-        void brakeMotor(bool initial_config = false);
-        void coastMotor();
-        void turnXRipples(uint16_t ripples_target, bool stops = true, bool direction = true, uint16_t speed = 0, float voltage = 0, float current = 0);
-        void turnXRevolutions(uint16_t revolutions_target, bool stops = true, bool direction = true, uint16_t speed = 0, float voltage = 0, float current = 0);
+        uint8_t setControlMode(ControlMode mode, bool I2CControl);
+        uint8_t setRegulationMode(RegulationMode regulation);
+        uint8_t turnForward(uint16_t speed = 0, float voltage = 0, float requested_current = 0);
+        uint8_t turnReverse(uint16_t speed = 0, float voltage = 0, float requested_current = 0);
+        uint8_t brakeMotor(bool initial_config = false);
+        uint8_t coastMotor();
+        uint8_t turnXRipples(uint16_t ripples_target, bool stops = true, bool direction = true, uint16_t speed = 0, float voltage = 0, float current = 0);
+        uint8_t turnXRevolutions(uint16_t revolutions_target, bool stops = true, bool direction = true, uint16_t speed = 0, float voltage = 0, float current = 0);
+        uint8_t home(const DRV8214_HomingConfig& homing, DRV8214_HomingResult* result = nullptr);
+
+        // --- Odometry Functions ---
+        int32_t updatePosition();
+        int32_t updatePosition(const DRV8214_Status& status);
+        int32_t getPosition();
+        void    setPosition(int32_t new_position);
+        void    zeroPosition();
+
+        // --- Soft Limit Functions ---
+        void    setSoftLimits(int32_t min_position, int32_t max_position, bool clip = true);
+        void    disableSoftLimits();   // Also restores the RC_HIZ and ripple threshold a limited move overrode
+        uint8_t enforceSoftLimits();
+
+        // --- Backlash Functions ---
+        void     setBacklash(uint16_t ripples);
+        uint16_t getBacklash();
+        int8_t   getBacklashSide();
+        int32_t  getOutputPosition();
+        uint8_t  calibrateRipplesPerRevolution(const DRV8214_RippleCalibration& calibration, float* measured = nullptr);
+        uint8_t  calibrateBacklash(const DRV8214_BacklashCalibration& calibration, uint16_t* measured = nullptr);
+
+        // --- Asynchronous Functions ---
+        uint8_t requestStatus();                         // Queue a status burst read, collect it with takeStatus()
+        bool    isStatusReady();
+        uint8_t takeStatus(DRV8214_Status& status);      // Decode the received snapshot and update the odometry
+        uint8_t requestRegulationTarget(uint8_t target); // Queue a WSET_VSET (REG_CTRL1) write
 
         // --- Other Functions ---
         void printMotorConfig(bool initial_config = false);
         void printFaultStatus();
+        uint8_t printRegisters(); // Field-decoded dump, differences from the expected image and validation
         #ifdef DRV8214_PLATFORM_ARDUINO
             void setDebugStream(Stream* debugPort);
         #endif
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Asynchronous register transfers. Operations are queued with drv8214_async_submit() and run one after the other,
+// the callback of each operation is called once its transfer has completed.
+//   STM32 : HAL_I2C_Mem_Read_DMA / HAL_I2C_Mem_Write_DMA, completion from the HAL I2C interrupt callbacks.
+//           Forward HAL_I2C_MemTxCpltCallback, HAL_I2C_MemRxCpltCallback and HAL_I2C_ErrorCallback to
+//           drv8214_async_irq_handler(), or define DRV8214_ASYNC_HAL_CALLBACKS to let this module define them.
+//           Callbacks then run in interrupt context.
+//   Linux : deterministic fake. The transfer runs through DRV8214_BUS_POLICY when it starts, its completion is
+//           reported once the modeled bus time has elapsed on a virtual clock advanced by drv8214_async_fake_advance().
+//   Arduino : Wire is blocking, transfers run and complete in drv8214_async_poll().
+#ifndef DRV8214_ASYNC_H
+#define DRV8214_ASYNC_H
+
+#include "drv8214_platform_config.h" // For platform detection
+#include "drv8214_bus.h"             // For DRV8214_BUS_MAX_BURST and the bus policy used by the fallback backends
+
+#ifndef DRV8214_ASYNC_QUEUE_SIZE
+    #define DRV8214_ASYNC_QUEUE_SIZE   8       // Pending operations, all drivers included
+#endif
+#ifndef DRV8214_ASYNC_FAKE_BUS_HZ
+    #define DRV8214_ASYNC_FAKE_BUS_HZ  400000  // SCL frequency modeled by the Linux fake
+#endif
+
+// Transfer results passed to the callbacks
+#define DRV8214_ASYNC_DONE    0  // Transfer completed
+#define DRV8214_ASYNC_ERROR   1  // Transfer failed (NACK, bus error, DMA error)
+
+struct DRV8214_AsyncOp {
+    uint8_t  address;                        // 7-bit I2C address
+    uint8_t  reg;                            // First register of the burst
+    uint8_t  length;                         // Number of registers, up to DRV8214_BUS_MAX_BURST
+    bool     read;                           // true: read into data, false: write data
+    uint8_t* data;                           // Read destination, must stay valid until the callback. Write payload, copied on submit.
+};
+
+typedef void (*DRV8214_AsyncCallback)(const DRV8214_AsyncOp& op, uint8_t result, void* context);
+
+// --- Queue Functions ---
+bool    drv8214_async_submit(const DRV8214_AsyncOp& op, DRV8214_AsyncCallback callback, void* context); // false if the queue is full
+bool    drv8214_async_read(uint8_t address, uint8_t reg, uint8_t* data, uint8_t length, DRV8214_AsyncCallback callback, void* context);
+bool    drv8214_async_write(uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length, DRV8214_AsyncCallback callback, void* context);
+uint8_t drv8214_async_pending();                  // Operations queued or in flight
+void    drv8214_async_poll();                     // Deliver completions on the platforms without interrupt completion
+bool    drv8214_async_flush(uint32_t timeout_ms); // Wait until the queue is empty, false on timeout
+
+#ifdef DRV8214_PLATFORM_STM32
+    void drv8214_async_irq_handler(I2C_HandleTypeDef* hi2c, bool success);
+#endif
+
+#ifdef DRV8214_PLATFORM_LINUX
+    void     drv8214_async_fake_advance(uint32_t dt_us); // Advance the virtual bus clock and deliver the completions due
+    uint32_t drv8214_async_fake_time();                  // Virtual bus clock in us
+    void     drv8214_async_fake_reset();                 // Drop pending operations and restart the virtual clock at 0
+#endif
+
+#endif // DRV8214_ASYNC_H
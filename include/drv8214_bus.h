@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Compile-time bus policies. A policy is a struct with two static functions making a single attempt:
+//   static uint8_t write(uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length);
+//   static uint8_t read(uint8_t address, uint8_t reg, uint8_t* data, uint8_t length);
+// returning a DRV8214_I2C_* result and bounded by drv8214_i2c_timeout_ms. DRV8214 accesses its registers through
+// DRV8214_RegisterAccess<DRV8214_BUS_POLICY>, which adds the retries and the accounting. With a native policy
+// selected (e.g. -DDRV8214_BUS_POLICY=DRV8214_ArduinoWireBus) every register access inlines down to the backend call.
+// The default DRV8214_PlatformBus keeps the transfers out of line in drv8214_platform_i2c.cpp.
+#ifndef DRV8214_BUS_H
+#define DRV8214_BUS_H
+
+#include "drv8214_platform_config.h" // For platform detection
+#include "drv8214_platform_i2c.h"    // For the platform handles and free functions
+#include "drv8214_timeline.h"        // Transfer spans, compiled out by default
+#include <string.h>
+
+#ifdef DRV8214_PLATFORM_LINUX
+    #include <linux/i2c.h>
+    #include <linux/i2c-dev.h>
+    #include <sys/ioctl.h>
+    #include <errno.h>
+#endif
+
+#define DRV8214_BUS_MAX_BURST 32  // Longest burst supported by the policies (the register map is 26 bytes)
+
+// Legacy path: one call into drv8214_platform_i2c.cpp per attempt
+struct DRV8214_PlatformBus {
+    static inline uint8_t write(uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length) {
+        return drv8214_i2c_try_write_registers(address, reg, data, length);
+    }
+    static inline uint8_t read(uint8_t address, uint8_t reg, uint8_t* data, uint8_t length) {
+        return drv8214_i2c_try_read_registers(address, reg, data, length);
+    }
+};
+
+#ifdef DRV8214_PLATFORM_ARDUINO
+struct DRV8214_ArduinoWireBus {
+    // The timeout is applied to Wire by drv8214_i2c_set_timeout()
+    static inline uint8_t result(uint8_t wire_status) {
+        switch (wire_status) {
+            case 0:  return DRV8214_I2C_OK;
+            case 2:  // Address not acknowledged
+            case 3:  return DRV8214_I2C_NACK; // Data not acknowledged
+            case 5:  return DRV8214_I2C_TIMEOUT;
+            default: return DRV8214_I2C_ERROR;
+        }
+    }
+    static inline uint8_t write(uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length) {
+        Wire.beginTransmission(address);
+        Wire.write(reg);
+        Wire.write(data, length);
+        return result(Wire.endTransmission());
+    }
+    static inline uint8_t read(uint8_t address, uint8_t reg, uint8_t* data, uint8_t length) {
+        // Sequential read, the register address auto-increments after each byte
+        Wire.beginTransmission(address);
+        Wire.write(reg);
+        uint8_t status = result(Wire.endTransmission(false)); // Send restart condition
+        uint8_t received = (status == DRV8214_I2C_OK) ? Wire.requestFrom(address, length) : 0;
+        for (uint8_t i = 0; i < length; i++) {
+            data[i] = (i < received && Wire.available()) ? Wire.read() : 0;
+        }
+        if (status == DRV8214_I2C_OK && received < length) { status = DRV8214_I2C_NACK; }
+        return status;
+    }
+};
+typedef DRV8214_ArduinoWireBus DRV8214_NativeBus;
+#endif
+
+#ifdef DRV8214_PLATFORM_STM32
+struct DRV8214_STM32HalBus {
+    static inline uint8_t result(HAL_StatusTypeDef status) {
+        switch (status) {
+            case HAL_OK:      return DRV8214_I2C_OK;
+            case HAL_TIMEOUT: return DRV8214_I2C_TIMEOUT;
+            case HAL_ERROR:   return (HAL_I2C_GetError(drv8214_i2c_handle) & HAL_I2C_ERROR_AF) ? DRV8214_I2C_NACK : DRV8214_I2C_ERROR;
+            default:          return DRV8214_I2C_ERROR; // HAL_BUSY
+        }
+    }
+    // STM32 HAL expects the 7-bit address to be shifted left by 1
+    static inline uint8_t write(uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length) {
+        if (drv8214_i2c_handle == NULL) { return DRV8214_I2C_ERROR; } // I2C handle not set
+        return result(HAL_I2C_Mem_Write(drv8214_i2c_handle, (uint16_t)(address << 1), reg, I2C_MEMADD_SIZE_8BIT, (uint8_t*)data, length, drv8214_i2c_timeout_ms));
+    }
+    static inline uint8_t read(uint8_t address, uint8_t reg, uint8_t* data, uint8_t length) {
+        uint8_t status = DRV8214_I2C_ERROR;
+        if (drv8214_i2c_handle != NULL) {
+            status = result(HAL_I2C_Mem_Read(drv8214_i2c_handle, (uint16_t)(address << 1), reg, I2C_MEMADD_SIZE_8BIT, data, length, drv8214_i2c_timeout_ms));
+        }
+        if (status != DRV8214_I2C_OK) { memset(data, 0, length); } // Error
+        return status;
+    }
+};
+typedef DRV8214_STM32HalBus DRV8214_NativeBus;
+#endif
+
+#ifdef DRV8214_PLATFORM_LINUX
+struct DRV8214_LinuxI2CBus {
+    // The adapter timeout is set with the I2C_TIMEOUT ioctl by drv8214_i2c_set_timeout()
+    static inline uint8_t result(int ret) {
+        if (ret >= 0) { return DRV8214_I2C_OK; }
+        switch (errno) {
+            case ENXIO:
+            case EREMOTEIO: return DRV8214_I2C_NACK;
+            case ETIMEDOUT: return DRV8214_I2C_TIMEOUT;
+            default:        return DRV8214_I2C_ERROR;
+        }
+    }
+    // Both directions use a single I2C_RDWR ioctl, the read is a write of the register address followed by a repeated start
+    static inline uint8_t write(uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length) {
+        uint8_t buffer[DRV8214_BUS_MAX_BURST + 1];
+        if (length > DRV8214_BUS_MAX_BURST) { length = DRV8214_BUS_MAX_BURST; }
+        buffer[0] = reg;
+        memcpy(buffer + 1, data, length);
+        struct i2c_msg msg = { address, 0, (uint16_t)(length + 1), buffer };
+        struct i2c_rdwr_ioctl_data transfer = { &msg, 1 };
+        return result(ioctl(drv8214_i2c_fd, I2C_RDWR, &transfer));
+    }
+    static inline uint8_t read(uint8_t address, uint8_t reg, uint8_t* data, uint8_t length) {
+        struct i2c_msg msgs[2] = {
+            { address, 0, 1, &reg },
+            { address, I2C_M_RD, length, data }
+        };
+        struct i2c_rdwr_ioctl_data transfer = { msgs, 2 };
+        uint8_t status = result(ioctl(drv8214_i2c_fd, I2C_RDWR, &transfer));
+        if (status != DRV8214_I2C_OK) { memset(data, 0, length); } // Error
+        return status;
+    }
+};
+typedef DRV8214_LinuxI2CBus DRV8214_NativeBus;
+#endif
+
+// Simulated devices attached with drv8214_sim_attach(), with optional fault injection, see drv8214_sim.h
+struct DRV8214_SimBus {
+    static uint8_t write(uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length);
+    static uint8_t read(uint8_t address, uint8_t reg, uint8_t* data, uint8_t length);
+};
+
+// Time a transfer occupies the bus: start, address, register, (repeated start, address), data, stop. 9 clocks per byte.
+inline uint32_t drv8214_bus_transfer_us(bool read, uint8_t length, uint32_t bus_hz) {
+    uint32_t bits = 1 + 9 + 9 + (read ? 1 + 9 : 0) + 9 * length + 1;
+    return (uint32_t)(((uint64_t)bits * 1000000 + bus_hz - 1) / bus_hz);
+}
+
+// Register level helpers built on a policy: retry budget, accounting, tracing, timeline spans, and no write after a failed read
+template <class Policy>
+struct DRV8214_RegisterAccess {
+    static inline uint8_t writeBurst(uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length) {
+        DRV8214_TIMELINE_SCOPE(span, "write", DRV8214_TIMELINE_BUS_TRACK, address, reg, length);
+        uint8_t result = Policy::write(address, reg, data, length);
+        uint8_t retry = 0;
+        for (; result != DRV8214_I2C_OK && retry < drv8214_i2c_retries; retry++) {
+            drv8214_i2c_count_attempt(result);
+            drv8214_i2c_stats.retries++;
+            result = Policy::write(address, reg, data, length);
+        }
+        drv8214_i2c_count_attempt(result);
+        drv8214_i2c_count_transfer(result, length);
+        drv8214_i2c_trace(address, reg, false, data, length, result, retry);
+        DRV8214_TIMELINE_RESULT(span, result);
+        return result;
+    }
+    static inline uint8_t readBurst(uint8_t address, uint8_t reg, uint8_t* data, uint8_t length) {
+        DRV8214_TIMELINE_SCOPE(span, "read", DRV8214_TIMELINE_BUS_TRACK, address, reg, length);
+        uint8_t result = Policy::read(address, reg, data, length);
+        uint8_t retry = 0;
+        for (; result != DRV8214_I2C_OK && retry < drv8214_i2c_retries; retry++) {
+            drv8214_i2c_count_attempt(result);
+            drv8214_i2c_stats.retries++;
+            result = Policy::read(address, reg, data, length);
+        }
+        drv8214_i2c_count_attempt(result);
+        drv8214_i2c_count_transfer(result, length);
+        if (result != DRV8214_I2C_OK) { memset(data, 0, length); } // Failed reads return 0
+        drv8214_i2c_trace(address, reg, true, data, length, result, retry);
+        DRV8214_TIMELINE_RESULT(span, result);
+        return result;
+    }
+    static inline uint8_t write(uint8_t address, uint8_t reg, uint8_t value) {
+        return writeBurst(address, reg, &value, 1);
+    }
+    static inline uint8_t read(uint8_t address, uint8_t reg, uint8_t* value) {
+        return readBurst(address, reg, value, 1);
+    }
+    static inline uint8_t modify(uint8_t address, uint8_t reg, uint8_t mask, uint8_t enable_bits) {
+        DRV8214_TIMELINE_SCOPE(span, "read-modify-write", DRV8214_TIMELINE_BUS_TRACK, address, reg, 1); // Holds the register between the two transfers
+        uint8_t value;
+        uint8_t result = read(address, reg, &value);
+        if (result != DRV8214_I2C_OK) { return result; } // Writing back would clobber the other bits
+        value = enable_bits ? (value | mask) : (value & ~mask); // Set or clear bits
+        return write(address, reg, value);
+    }
+    static inline uint8_t modifyBits(uint8_t address, uint8_t reg, uint8_t mask, uint8_t new_value) {
+        DRV8214_TIMELINE_SCOPE(span, "read-modify-write", DRV8214_TIMELINE_BUS_TRACK, address, reg, 1); // Holds the register between the two transfers
+        uint8_t value;
+        uint8_t result = read(address, reg, &value);
+        if (result != DRV8214_I2C_OK) { return result; }
+        value = (value & ~mask) | (new_value & mask); // Apply new value only to masked bits
+        return write(address, reg, value);
+    }
+};
+
+#ifndef DRV8214_BUS_POLICY
+    #define DRV8214_BUS_POLICY DRV8214_PlatformBus
+#endif
+
+#endif // DRV8214_BUS_H
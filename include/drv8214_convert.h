@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Conversion of raw status registers into engineering units, one value or whole arrays at once. Each conversion is a
+// single multiplication by a per-driver scale (plus a clamp for the voltage), the scales come from
+// DRV8214::getUnitScales(). The batch kernels use SSE2 on x86 and NEON on ARM, 16 samples per iteration, and give
+// results bit-identical to the scalar functions below, which DRV8214::convertMotorVoltage() and its siblings use too.
+// Define DRV8214_CONVERT_SCALAR to build the portable loops only.
+#ifndef DRV8214_CONVERT_H
+#define DRV8214_CONVERT_H
+
+#include <stdint.h>
+
+// Scales of one driver, valid until its voltage range, OVP, CS_GAIN_SEL or W_SCALE setting changes
+struct DRV8214_UnitScales {
+    float volts_per_lsb;    // REG_STATUS1
+    float volts_max;        // Clamp of the voltage, 11 V with OVP
+    float amps_per_lsb;     // REG_STATUS2
+    float rpm_per_lsb;      // RC_STATUS1, rotor RPM
+};
+
+// --- Scalar Conversions ---
+inline float drv8214_convert_voltage(uint8_t raw, float volts_per_lsb, float volts_max) {
+    float volts = raw * volts_per_lsb;
+    return volts < volts_max ? volts : volts_max;
+}
+inline float drv8214_convert_current(uint8_t raw, float amps_per_lsb) {
+    return raw * amps_per_lsb;
+}
+inline uint8_t drv8214_convert_duty(uint8_t raw) {
+    return (uint8_t)(((raw & 0x3F) * 100) / 63); // 6-bit duty cycle to percent
+}
+inline float drv8214_convert_speed(uint8_t raw, float rpm_per_lsb) {
+    return raw * rpm_per_lsb;
+}
+
+// --- Batch Kernels ---
+// One scale per sample, so a batch may mix drivers (scale columns of a fleet, or a repeated value for one driver)
+void drv8214_convert_voltage_batch(const uint8_t* raw, const float* volts_per_lsb, const float* volts_max, float* volts, uint32_t count);
+void drv8214_convert_current_batch(const uint8_t* raw, const float* amps_per_lsb, float* amps, uint32_t count);
+void drv8214_convert_duty_batch(const uint8_t* raw, uint8_t* percent, uint32_t count);
+void drv8214_convert_speed_batch(const uint8_t* raw, const float* rpm_per_lsb, float* rpm, uint32_t count);
+const char* drv8214_convert_isa(); // "sse2", "neon" or "scalar"
+
+#endif // DRV8214_CONVERT_H
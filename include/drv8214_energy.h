@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Per-driver energy meter and first-order winding thermal model, fed by DRV8214_Status snapshots.
+#ifndef DRV8214_ENERGY_H
+#define DRV8214_ENERGY_H
+
+#include "DRV8214.h"
+
+struct DRV8214_ThermalConfig {
+    float ambient_temperature = 25.0f;    // Ambient temperature in °C
+    float thermal_resistance = 20.0f;     // Winding to ambient thermal resistance in °C/W
+    float thermal_time_constant = 60.0f;  // Winding thermal time constant in s
+    float derating_temperature = 80.0f;   // Winding temperature at which the speed setpoint starts being throttled in °C
+    float max_temperature = 110.0f;       // Winding temperature at which the speed setpoint reaches min_speed_ratio in °C
+    float min_speed_ratio = 0.0f;         // Fraction of the requested speed allowed at max_temperature (0: motor stopped)
+    uint32_t max_sample_gap_us = 1000000; // Snapshots further apart than this are not integrated (polling was interrupted)
+};
+
+class DRV8214EnergyMeter {
+
+    private:
+        DRV8214& driver;                 // Driver providing the register conversions and motor resistance
+        DRV8214_ThermalConfig config;
+
+        float    energy;                 // Electrical energy delivered to the motor in J
+        float    copper_loss;            // Energy dissipated in the winding resistance in J
+        float    peak_power;             // Highest electrical power seen in W
+        float    last_power;             // Electrical power of the last snapshot in W
+        float    last_loss;              // Copper loss power of the last snapshot in W
+        float    winding_temperature;    // Estimated winding temperature in °C
+        uint32_t last_timestamp_us;      // Timestamp of the last snapshot
+        bool     has_sample;             // False until the first snapshot is received
+
+    public:
+        // Constructor
+        DRV8214EnergyMeter(DRV8214& drv, const DRV8214_ThermalConfig& cfg = DRV8214_ThermalConfig()) : driver(drv), config(cfg) { reset(); }
+
+        void reset();
+        void update(const DRV8214_Status& status, uint32_t timestamp_us);
+
+        // --- Thermal Throttling ---
+        float    getSpeedRatio() const;
+        uint16_t throttleSpeed(uint16_t speed) const;
+        bool     isThermalLimitApproached() const { return winding_temperature >= config.derating_temperature; }
+
+        // --- Helper Functions ---
+        float getEnergy() const { return energy; }
+        float getCopperLoss() const { return copper_loss; }
+        float getPower() const { return last_power; }
+        float getPeakPower() const { return peak_power; }
+        float getWindingTemperature() const { return winding_temperature; }
+};
+
+#endif // DRV8214_ENERGY_H
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Typed register fields. A field type carries its register address and mask, so a value can only be written to the
+// register the field belongs to. DRV8214_FIELD(CONFIG0, EN_OUT) pairs DRV8214_CONFIG0 with CONFIG0_EN_OUT: a mask
+// from another register does not exist under that name and fails to compile.
+//
+// Field values of the same register compose at compile time into one register update:
+//   constexpr auto forward = FIELD_CONFIG4_I2C_EN_IN1::set(1) | FIELD_CONFIG4_I2C_PH_IN2::set(0);
+// Combining fields of different registers does not compile.
+#ifndef DRV8214_FIELD_H
+#define DRV8214_FIELD_H
+
+#include <stdint.h>
+
+// Position of the lowest set bit of a mask
+constexpr uint8_t drv8214_mask_shift(uint8_t mask) {
+    return (mask & 0x01) ? 0 : 1 + drv8214_mask_shift((uint8_t)(mask >> 1));
+}
+
+// True if the set bits of a mask are adjacent
+constexpr bool drv8214_mask_contiguous(uint8_t mask) {
+    return ((((uint16_t)(mask >> drv8214_mask_shift(mask))) + 1) & (mask >> drv8214_mask_shift(mask))) == 0;
+}
+
+// Bits to update in one register and their new value
+template <uint8_t Reg>
+struct DRV8214_FieldSet {
+    uint8_t mask;   // Bits written
+    uint8_t value;  // New value of these bits, already in position
+
+    constexpr DRV8214_FieldSet operator|(const DRV8214_FieldSet& other) const {
+        return DRV8214_FieldSet{ (uint8_t)(mask | other.mask), (uint8_t)(value | other.value) };
+    }
+    constexpr uint8_t apply(uint8_t current) const {
+        return (uint8_t)((current & ~mask) | value);
+    }
+};
+
+template <uint8_t Reg, uint8_t Mask>
+struct DRV8214_Field {
+    static_assert(Mask != 0, "A field needs at least one bit");
+    static_assert(drv8214_mask_contiguous(Mask), "Field bits must be contiguous");
+
+    static constexpr uint8_t reg = Reg;
+    static constexpr uint8_t mask = Mask;
+    static constexpr uint8_t shift = drv8214_mask_shift(Mask);
+    static constexpr uint8_t max_value = Mask >> drv8214_mask_shift(Mask); // Largest value the field holds
+
+    // Values wider than the field are truncated to its bits, callers clamp first where it matters
+    static constexpr uint8_t encode(uint8_t value) { return (uint8_t)((value << shift) & mask); }
+    static constexpr uint8_t decode(uint8_t register_value) { return (uint8_t)((register_value & mask) >> shift); }
+    static constexpr DRV8214_FieldSet<Reg> set(uint8_t value) { return DRV8214_FieldSet<Reg>{ Mask, encode(value) }; }
+};
+
+#define DRV8214_FIELD(reg, name) DRV8214_Field<DRV8214_##reg, reg##_##name>
+
+#endif // DRV8214_FIELD_H
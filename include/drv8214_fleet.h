@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Structure-of-arrays container for large numbers of drivers (test rigs, host-side supervision). Each quantity is
+// a contiguous column indexed by driver, so the batch operations run as straight loops over arrays that the
+// compiler vectorises: decode every status snapshot, update every position, check every fault byte.
+//
+// Below about 20 drivers (x86-64, see tools/drv8214_fleet_bench.cpp) the loops fill no vector block and one DRV8214
+// object per driver is faster.
+//
+// The fleet monitors drivers, motion commands stay with DRV8214. Its storage is sized at compile time:
+//   static DRV8214Fleet<512> fleet;
+//   fleet.add(DRV8214_I2C_ADDR_00);
+//   fleet.readStatus(); fleet.decodeStatus(); fleet.updateOdometry();
+//   uint16_t stalled = fleet.checkFaults(FAULT_STALL, flagged);
+#ifndef DRV8214_FLEET_H
+#define DRV8214_FLEET_H
+
+#include "DRV8214.h"
+
+#define DRV8214_FLEET_STATUS_BYTES  7  // FAULT to REG_STATUS3, read in one burst per driver
+#define DRV8214_FLEET_SLOT_BYTES    8  // Snapshot slot in the raw buffer, padded to 8 bytes so the decode vectorises
+
+// --- Batch Kernels ---
+// The arrays passed to a kernel must not overlap (__restrict), which spares the compiler the run-time alias checks.
+// Split count raw snapshots (in bus order, one every DRV8214_FLEET_SLOT_BYTES) into one column per status register
+void     drv8214_fleet_decode_status(const uint8_t* __restrict raw, uint16_t count, uint8_t* __restrict fault, uint8_t* __restrict speed,
+                                     uint16_t* __restrict ripple_count, uint8_t* __restrict voltage, uint8_t* __restrict current,
+                                     uint8_t* __restrict duty);
+// Accumulate the ripples counted since the previous update, in the direction of each driver
+void     drv8214_fleet_update_odometry(const uint16_t* __restrict ripple_count, uint16_t* __restrict last_ripple_count,
+                                       const int8_t* __restrict direction, int32_t* __restrict position, uint16_t count);
+// flagged[i] = fault[i] & mask, returns the number of drivers with at least one of the bits set
+uint16_t drv8214_fleet_check_faults(const uint8_t* __restrict fault, uint8_t mask, uint8_t* __restrict flagged, uint16_t count);
+
+template <uint16_t Capacity>
+class DRV8214Fleet {
+
+    private:
+        typedef DRV8214_RegisterAccess<DRV8214_BUS_POLICY> Bus;
+
+        uint16_t count = 0;                                    // Drivers added
+        uint8_t  address[Capacity];                            // I2C address of each driver
+        int8_t   direction[Capacity];                          // Direction of the motion in progress (1: forward, -1: reverse)
+
+        // Configuration image, register-major: shadow[reg - DRV8214_CONFIG0][driver]
+        uint8_t  shadow[DRV8214_CONFIG_COUNT][Capacity];
+
+        // Latest status: raw snapshots as read from the bus, one per slot, then one column per register
+        uint8_t  raw[Capacity * DRV8214_FLEET_SLOT_BYTES];
+        uint8_t  fault[Capacity];
+        uint8_t  speed[Capacity];
+        uint16_t ripple_count[Capacity];
+        uint8_t  voltage[Capacity];
+        uint8_t  current[Capacity];
+        uint8_t  duty[Capacity];
+
+        // Odometry
+        int32_t  position[Capacity];                           // Absolute position in ripples
+        uint16_t last_ripple_count[Capacity];                  // Ripple counter value already accounted in position
+
+    public:
+        // Returns the index of the new driver, or -1 when the fleet is full. Its image starts at the reset values.
+        int16_t add(uint8_t addr) {
+            if (count >= Capacity) { return -1; }
+            uint16_t i = count++;
+            address[i] = addr;
+            direction[i] = 1;
+            for (uint8_t reg = 0; reg < DRV8214_CONFIG_COUNT; reg++) { shadow[reg][i] = DRV8214_RESET_VALUES[DRV8214_CONFIG0 + reg]; }
+            for (uint8_t b = 0; b < DRV8214_FLEET_SLOT_BYTES; b++) { raw[i * DRV8214_FLEET_SLOT_BYTES + b] = 0; }
+            fault[i] = speed[i] = voltage[i] = current[i] = duty[i] = 0;
+            ripple_count[i] = last_ripple_count[i] = 0;
+            position[i] = 0;
+            return (int16_t)i;
+        }
+        void clear() { count = 0; }
+
+        // --- Bus Functions ---
+        // One status burst per driver into the raw buffer. Returns the number of failed reads, their snapshot reads as 0.
+        uint16_t readStatus() {
+            uint16_t failed = 0;
+            for (uint16_t i = 0; i < count; i++) {
+                if (Bus::readBurst(address[i], DRV8214_FAULT, raw + i * DRV8214_FLEET_SLOT_BYTES, DRV8214_FLEET_STATUS_BYTES) != DRV8214_I2C_OK) { failed++; }
+            }
+            return failed;
+        }
+        // Configuration image of one driver read back from the device
+        uint8_t syncShadow(uint16_t i) {
+            uint8_t image[DRV8214_CONFIG_COUNT];
+            if (Bus::readBurst(address[i], DRV8214_CONFIG0, image, DRV8214_CONFIG_COUNT) != DRV8214_I2C_OK) { return DRV8214_ERR_BUS; }
+            for (uint8_t reg = 0; reg < DRV8214_CONFIG_COUNT; reg++) { shadow[reg][i] = image[reg]; }
+            return DRV8214_OK;
+        }
+        // Same sequence as DRV8214::restoreConfiguration(): the image in one burst, CONFIG0 last since it holds EN_OUT
+        uint8_t restoreConfiguration(uint16_t i, bool clear_faults = false) {
+            uint8_t image[DRV8214_CONFIG_COUNT];
+            for (uint8_t reg = 0; reg < DRV8214_CONFIG_COUNT; reg++) { image[reg] = shadow[reg][i]; }
+            if (Bus::writeBurst(address[i], DRV8214_CONFIG1, image + 1, DRV8214_CONFIG_COUNT - 1) != DRV8214_I2C_OK) { return DRV8214_ERR_BUS; }
+            image[0] |= clear_faults ? CONFIG0_CLR_FLT : 0;
+            if (Bus::writeBurst(address[i], DRV8214_CONFIG0, image, 1) != DRV8214_I2C_OK) { return DRV8214_ERR_BUS; }
+            if (clear_faults) { last_ripple_count[i] = 0; } // After a power-on reset the counter restarted from 0
+            return DRV8214_OK;
+        }
+
+        // --- Batch Functions ---
+        void     decodeStatus() { decodeStatus(raw); }
+        void     decodeStatus(const uint8_t* snapshots) { drv8214_fleet_decode_status(snapshots, count, fault, speed, ripple_count, voltage, current, duty); }
+        void     updateOdometry() { drv8214_fleet_update_odometry(ripple_count, last_ripple_count, direction, position, count); }
+        uint16_t checkFaults(uint8_t mask, uint8_t* flagged) { return drv8214_fleet_check_faults(fault, mask, flagged, count); }
+
+        // --- Helper Functions ---
+        uint16_t size() const { return count; }
+        uint8_t  getAddress(uint16_t i) const { return address[i]; }
+        void     setDirection(uint16_t i, int8_t dir) { direction[i] = dir; }
+        uint8_t  getShadowRegister(uint16_t i, uint8_t reg) const { return shadow[reg - DRV8214_CONFIG0][i]; }
+        void     setShadowRegister(uint16_t i, uint8_t reg, uint8_t value) { shadow[reg - DRV8214_CONFIG0][i] = value; }
+        uint8_t* statusBuffer() { return raw; } // Slots filled elsewhere (asynchronous reads), then decodeStatus()
+        void     setPosition(uint16_t i, int32_t new_position) { position[i] = new_position; }
+
+        // --- Columns ---
+        const uint8_t*  faults() const { return fault; }
+        const uint8_t*  speeds() const { return speed; }
+        const uint16_t* rippleCounts() const { return ripple_count; }
+        const uint8_t*  voltages() const { return voltage; }
+        const uint8_t*  currents() const { return current; }
+        const uint8_t*  duties() const { return duty; }
+        const int32_t*  positions() const { return position; }
+};
+
+#endif // DRV8214_FLEET_H
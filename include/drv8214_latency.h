@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Latency histograms of the public DRV8214 calls, one per method and per driver, for the rare slow calls that
+// averages hide. Only the entry points are timed: a method called by another method of the same driver (the
+// setters called by init(), setRegulationMode() called by turnForward()) counts in its caller. A call is timed from
+// entry to return and counted in a log-linear bucket:
+// exact below 4 us, then 4 buckets per power of two (at most 25 % wide) up to 2^26 us, longer calls land in the last
+// bucket. The exact maximum is kept besides.
+//
+// Enable with -DDRV8214_LATENCY=1. Histograms come from a static pool of DRV8214_LATENCY_HISTOGRAMS, taken the first
+// time a driver calls a method; calls that find the pool exhausted are only counted by drv8214_latency_dropped().
+// Disabled (the default), nothing is timed and the functions below are empty inline stubs.
+//
+// Scraping: drv8214_latency_report() with reset = true returns the histogram and clears it for the next period.
+// Recording is not synchronized, scrape from the context that calls the drivers.
+#ifndef DRV8214_LATENCY_H
+#define DRV8214_LATENCY_H
+
+#include "drv8214_platform_config.h" // For platform detection
+#include "drv8214_platform_time.h"
+
+#ifndef DRV8214_LATENCY
+    #define DRV8214_LATENCY  0
+#endif
+#ifndef DRV8214_LATENCY_HISTOGRAMS
+    #define DRV8214_LATENCY_HISTOGRAMS  64   // Pool shared by all drivers, 420 bytes each
+#endif
+#ifndef DRV8214_LATENCY_APIS
+    #define DRV8214_LATENCY_APIS  128        // Distinct methods, one byte per method in every DRV8214 instance
+#endif
+
+#define DRV8214_LATENCY_BUCKETS  100         // 0 to 3 us exact, then 4 per power of two up to 2^26 us
+#define DRV8214_LATENCY_NONE     0xFF        // API id when DRV8214_LATENCY_APIS is exhausted
+
+typedef void (*DRV8214_PrintCallback)(const char* line, void* context); // As in drv8214_regmap.h
+
+struct DRV8214_LatencyReport {
+    const char* api;         // Method name
+    uint8_t  driver_id;
+    uint32_t count;
+    uint32_t mean_us;
+    uint32_t p50_us;         // Percentiles: upper bound of the bucket, at most max_us
+    uint32_t p99_us;
+    uint32_t p999_us;
+    uint32_t max_us;
+};
+
+// Bucket of a duration, and the largest duration it holds
+inline uint8_t drv8214_latency_bucket(uint32_t us) {
+    if (us < 4) { return (uint8_t)us; }
+    uint8_t octave = (uint8_t)(sizeof(unsigned long) * 8 - 1 - __builtin_clzl(us)); // 2 or more, unsigned int is 16-bit on AVR
+    if (octave > 25) { return DRV8214_LATENCY_BUCKETS - 1; }
+    return (uint8_t)(4 * (octave - 1) + ((us >> (octave - 2)) & 3));
+}
+inline uint32_t drv8214_latency_bucket_max(uint8_t bucket) {
+    if (bucket < 4) { return bucket; }
+    uint8_t octave = (uint8_t)(bucket / 4 + 1);
+    return ((uint32_t)(4 + bucket % 4 + 1) << (octave - 2)) - 1;
+}
+
+#if DRV8214_LATENCY
+
+extern uint32_t (*drv8214_latency_clock)();
+
+void     drv8214_latency_set_clock(uint32_t (*clock)()); // drv8214_time_micros() by default, nullptr restores it
+uint8_t  drv8214_latency_register(const char* api);      // Id of a method name, DRV8214_LATENCY_NONE if the table is full
+void     drv8214_latency_record(uint8_t* slots, uint8_t driver_id, uint8_t api, uint32_t us);
+uint8_t  drv8214_latency_count();                        // Histograms in use, reports are numbered 0 to count - 1
+bool     drv8214_latency_report(uint8_t index, DRV8214_LatencyReport& report, bool reset = false);
+void     drv8214_latency_reset();                        // Clears every histogram, they stay assigned
+uint32_t drv8214_latency_dropped();                      // Calls not recorded since the pool or the API table was full
+void     drv8214_latency_print(DRV8214_PrintCallback print, void* context, bool reset = false);
+
+// Times the enclosing call unless it is nested in another timed call of the same driver. slots and depth belong to
+// the instance, see DRV8214::latency_slots.
+struct DRV8214_LatencyScope {
+    uint8_t* slots;
+    uint8_t& depth;
+    uint32_t start_us;
+    uint8_t  driver_id;
+    uint8_t  api;
+
+    DRV8214_LatencyScope(uint8_t* slots, uint8_t& depth, uint8_t driver_id, uint8_t api) : slots(slots), depth(depth), start_us(0), driver_id(driver_id), api(api) {
+        if (depth++ == 0) { start_us = drv8214_latency_clock(); }
+    }
+    ~DRV8214_LatencyScope() {
+        if (--depth == 0) { drv8214_latency_record(slots, driver_id, api, drv8214_latency_clock() - start_us); }
+    }
+};
+
+    // The method name is registered once, by the first call
+    #define DRV8214_LATENCY_SCOPE(scope, slots, depth, driver_id, api) \
+        static const uint8_t scope##_api = drv8214_latency_register(api); \
+        DRV8214_LatencyScope scope(slots, depth, driver_id, scope##_api)
+
+#else
+
+inline void     drv8214_latency_set_clock(uint32_t (*clock)()) { (void)clock; }
+inline uint8_t  drv8214_latency_count() { return 0; }
+inline bool     drv8214_latency_report(uint8_t index, DRV8214_LatencyReport& report, bool reset = false) { (void)index; (void)report; (void)reset; return false; }
+inline void     drv8214_latency_reset() { }
+inline uint32_t drv8214_latency_dropped() { return 0; }
+inline void     drv8214_latency_print(DRV8214_PrintCallback print, void* context, bool reset = false) { (void)print; (void)context; (void)reset; }
+
+    #define DRV8214_LATENCY_SCOPE(scope, slots, depth, driver_id, api)  do { } while (0)
+
+#endif
+
+#endif // DRV8214_LATENCY_H
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Compile-time logging policy. Select it with DRV8214_LOG_MODE (e.g. -DDRV8214_LOG_MODE=DRV8214_LOG_NONE):
+//   DRV8214_LOG_NONE   : log statements, format strings and verbose checks are compiled out
+//   DRV8214_LOG_BINARY : event id and raw arguments are pushed to a ring buffer, formatted later on the host
+//   DRV8214_LOG_TEXT   : formatted with snprintf and printed when verbose is set in DRV8214_Config (default, legacy behaviour)
+// This header is platform independent so the host decoder can use it.
+#ifndef DRV8214_LOG_H
+#define DRV8214_LOG_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define DRV8214_LOG_NONE     0
+#define DRV8214_LOG_BINARY   1
+#define DRV8214_LOG_TEXT     2
+
+#ifndef DRV8214_LOG_MODE
+    #define DRV8214_LOG_MODE DRV8214_LOG_TEXT
+#endif
+
+#define DRV8214_LOG_MAX_ARGS  4   // Maximum number of arguments per event
+#ifndef DRV8214_LOG_RING_SIZE
+    #define DRV8214_LOG_RING_SIZE 32  // Number of records held by the binary ring, must be a power of two
+#endif
+
+// Event table: id and format string. Arguments formatted with %f/%e/%g are stored as float bits, all others as 32-bit integers.
+// New events must be appended at the end so already captured logs keep decoding.
+#define DRV8214_LOG_EVENTS(X) \
+    X(CURRENT_GAIN,     "Requested Itrip = %f A => Chosen CS_GAIN_SEL: 0b%d => Aipropri = %f uA/A => Actual Itrip = %f A\n") \
+    X(RIPPLE_SPEED,     "WSET_VSET: %d | W_SCALE: %d or 0b%d | Effective Target Speed: %d rad/s\n") \
+    X(RIPPLE_THRESHOLD, "RC_THR: %d | RC_THR_SCALE: %d ") \
+    X(TURN_FORWARD,     "Turning Forward\n") \
+    X(TURN_REVERSE,     "Turning Reverse\n") \
+    X(BRAKE,            "Braking Motor\n") \
+    X(COAST,            "Coasting Motor\n") \
+    X(COAST_UNSUPPORTED,"PH/EN mode does not support coast (High-Z) while awake.") \
+    X(HOMING,           "Homing: status %d | to stop: %lu ms, %u ripples | total: %lu ms\n") \
+    X(POWER_ON_RESET,   "Power-on reset #%u: configuration restored with status %d\n") \
+    X(SCRUB_REPAIR,     "Scrub: register 0x%x read 0x%x instead of 0x%x, drifted bits 0x%x\n") \
+    X(SCRUB_FIELD,      "Scrub: field %u of register 0x%x read 0x%x instead of 0x%x\n")
+
+#define DRV8214_LOG_ENUM_ENTRY(name, format) DRV8214_EV_##name,
+enum DRV8214_LogEvent {
+    DRV8214_LOG_EVENTS(DRV8214_LOG_ENUM_ENTRY)
+    DRV8214_EV_COUNT
+};
+#undef DRV8214_LOG_ENUM_ENTRY
+
+// Binary record, 24 bytes, little-endian on all supported targets
+struct DRV8214_LogRecord {
+    uint32_t timestamp_us;                  // drv8214_time_micros() when the event was logged
+    uint8_t  event;                         // DRV8214_LogEvent
+    uint8_t  driver_id;                     // ID of the driver that logged the event
+    uint8_t  argc;                          // Number of valid entries in args
+    uint8_t  reserved;
+    uint32_t args[DRV8214_LOG_MAX_ARGS];    // Raw arguments, floats stored as their IEEE-754 bits
+};
+
+// --- Binary Ring Functions ---
+void     drv8214_log_push(uint32_t timestamp_us, uint8_t driver_id, uint8_t event, const uint32_t* args, uint8_t argc);
+uint16_t drv8214_log_drain(DRV8214_LogRecord* records, uint16_t max_records);
+uint32_t drv8214_log_dropped();
+
+// --- Decoding Functions (host side, or text mode) ---
+const char* drv8214_log_format(uint8_t event);
+size_t      drv8214_log_decode(const DRV8214_LogRecord& record, char* buffer, size_t length);
+
+// Argument packing for the binary mode
+inline uint32_t drv8214_log_pack(float value) { uint32_t bits; memcpy(&bits, &value, sizeof(bits)); return bits; }
+inline uint32_t drv8214_log_pack(double value) { return drv8214_log_pack((float)value); }
+template <typename T> inline uint32_t drv8214_log_pack(T value) { return (uint32_t)value; }
+
+inline void drv8214_log_write(uint32_t timestamp_us, uint8_t driver_id, uint8_t event) {
+    drv8214_log_push(timestamp_us, driver_id, event, nullptr, 0);
+}
+
+template <typename... Args>
+inline void drv8214_log_write(uint32_t timestamp_us, uint8_t driver_id, uint8_t event, Args... args) {
+    static_assert(sizeof...(Args) <= DRV8214_LOG_MAX_ARGS, "Too many arguments for a DRV8214 log event");
+    const uint32_t packed[] = { drv8214_log_pack(args)... };
+    drv8214_log_push(timestamp_us, driver_id, event, packed, sizeof...(Args));
+}
+
+// Log statement for DRV8214 members, gated at runtime by the verbose flag in binary and text modes
+#if DRV8214_LOG_MODE == DRV8214_LOG_NONE
+    #define DRV8214_LOG(event, ...) do { } while (0)
+#elif DRV8214_LOG_MODE == DRV8214_LOG_BINARY
+    #define DRV8214_LOG(event, ...) do { if (verbose) { drv8214_log_write(drv8214_time_micros(), driver_ID, DRV8214_EV_##event, ##__VA_ARGS__); } } while (0)
+#else
+    #define DRV8214_LOG(event, ...) do { if (verbose) { drvPrintf(drv8214_log_format(DRV8214_EV_##event), ##__VA_ARGS__); } } while (0)
+#endif
+
+#endif // DRV8214_LOG_H
@@ -18,8 +18,13 @@
     #define DRV8214_PLATFORM_STM32
     #include <stdio.h>         // For snprintf
     #include <math.h>
+#elif defined(__linux__)
+    #define DRV8214_PLATFORM_LINUX
+    #include <stdint.h>
+    #include <stdio.h>         // For snprintf
+    #include <math.h>
 #else
-    #error "Unsupported platform. Define DRV8214_PLATFORM_ARDUINO or DRV8214_PLATFORM_STM32 manually or fix auto-detection."
+    #error "Unsupported platform. Define DRV8214_PLATFORM_ARDUINO, DRV8214_PLATFORM_STM32 or DRV8214_PLATFORM_LINUX manually or fix auto-detection."
 #endif
 
 #endif // DRV8214_PLATFORM_CONFIG_H
\ No newline at end of file
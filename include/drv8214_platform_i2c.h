@@ -21,15 +21,166 @@
     #include "stm32wbxx_hal.h" // This should be the main HAL include for your MCU. Can be found in main.h
     #include "i2c.h"           // This is the CubeMX generated i2c.h, which declares hi2c1 and MX_I2C1_Init()
 
+    // I2C handle used by this module, exposed so the STM32 bus policy can inline its accesses
+    extern I2C_HandleTypeDef* drv8214_i2c_handle;
+
     // Function to set the I2C handle for this module to use
     // Call this once during initialization in main.c
     void drv8214_i2c_set_handle(I2C_HandleTypeDef* hi2c);
 #endif
 
-// Common I2C function declarations
-void drv8214_i2c_write_register(uint8_t device_address, uint8_t reg, uint8_t value);
-uint8_t drv8214_i2c_read_register(uint8_t device_address, uint8_t reg);
-void drv8214_i2c_modify_register(uint8_t device_address, uint8_t reg, uint8_t mask, uint8_t enable_bits); // Changed bool to uint8_t
-void drv8214_i2c_modify_register_bits(uint8_t device_address, uint8_t reg, uint8_t mask, uint8_t new_value);
+#ifdef DRV8214_PLATFORM_LINUX
+    // File descriptor of the i2c-dev adapter used by this module, exposed so the Linux bus policy can inline its accesses
+    extern int drv8214_i2c_fd;
+
+    // Open the i2c-dev adapter (e.g. "/dev/i2c-1"), returns false on failure
+    bool drv8214_i2c_open(const char* device);
+    void drv8214_i2c_set_fd(int fd);
+#endif
+
+// Transfer results returned by the I2C functions and the bus policies
+#define DRV8214_I2C_OK       0  // Transfer completed
+#define DRV8214_I2C_NACK     1  // Address or data byte not acknowledged
+#define DRV8214_I2C_TIMEOUT  2  // Transfer did not complete within drv8214_i2c_timeout_ms
+#define DRV8214_I2C_ERROR    3  // Bus error, arbitration lost or no adapter
+
+#ifndef DRV8214_I2C_BUS_HZ
+    #define DRV8214_I2C_BUS_HZ  400000  // SCL frequency assumed when accounting bus time
+#endif
+
+// Bus counters, updated by every register access
+struct DRV8214_I2CStats {
+    uint32_t transfers;       // Transfers requested, retries excluded
+    uint32_t bytes;           // Register bytes transferred successfully
+    uint32_t nacks;           // Attempts not acknowledged
+    uint32_t timeouts;        // Attempts that timed out
+    uint32_t errors;          // Attempts that failed with another bus error
+    uint32_t retries;         // Attempts repeated after a failure
+    uint32_t failures;        // Transfers that failed after the whole retry budget
+    uint32_t recoveries;      // Bus recoveries run by drv8214_i2c_recover_bus()
+    uint32_t scrub_transfers; // Transfers issued by the configuration scrubber, repairs included
+    uint32_t scrub_us;        // Bus time of these transfers at DRV8214_I2C_BUS_HZ
+};
+
+// Bus recovery hooks. The pins are open drain: true releases the line, false pulls it low.
+// Platform defaults: Arduino uses the SDA/SCL pins and Wire.begin(), STM32 reinitialises drv8214_i2c_handle
+// (the clocking hooks must be provided, the pins are board specific), Linux reopens the i2c-dev adapter.
+struct DRV8214_BusRecoveryHooks {
+    void (*set_scl)(bool level) = nullptr;     // Drive SCL as a GPIO
+    void (*set_sda)(bool level) = nullptr;     // Drive SDA as a GPIO
+    bool (*read_sda)() = nullptr;              // Level of SDA
+    void (*reinit)() = nullptr;                // Hand the pins back to the I2C peripheral and reinitialise it
+};
+
+// Worst case time spent in one transfer is (drv8214_i2c_retries + 1) * drv8214_i2c_timeout_ms
+extern uint16_t drv8214_i2c_timeout_ms;  // Per attempt timeout, 10 ms by default
+extern uint8_t  drv8214_i2c_retries;     // Attempts repeated after a failure, 2 by default
+extern DRV8214_I2CStats drv8214_i2c_stats;
+extern volatile bool drv8214_i2c_recovery_pending; // Set when a transfer fails with a timeout or a bus error
+
+void drv8214_i2c_set_timeout(uint16_t timeout_ms);
+void drv8214_i2c_set_retries(uint8_t retries);
+void drv8214_i2c_get_stats(DRV8214_I2CStats& stats);
+void drv8214_i2c_reset_stats();
+void drv8214_i2c_set_recovery_hooks(const DRV8214_BusRecoveryHooks& hooks);
+uint8_t drv8214_i2c_recover_bus(); // 9-clock SCL recovery, STOP, peripheral reinit. DRV8214_I2C_OK once SDA is released.
+
+inline void drv8214_i2c_count_attempt(uint8_t result) {
+    switch (result) {
+        case DRV8214_I2C_OK:      break;
+        case DRV8214_I2C_NACK:    drv8214_i2c_stats.nacks++; break;
+        case DRV8214_I2C_TIMEOUT: drv8214_i2c_stats.timeouts++; break;
+        default:                  drv8214_i2c_stats.errors++; break;
+    }
+}
+
+inline void drv8214_i2c_count_transfer(uint8_t result, uint8_t length) {
+    drv8214_i2c_stats.transfers++;
+    if (result == DRV8214_I2C_OK) { drv8214_i2c_stats.bytes += length; } else { drv8214_i2c_stats.failures++; }
+    // A NACK only tells that one device did not answer, timeouts and bus errors point at the bus itself
+    if (result == DRV8214_I2C_TIMEOUT || result == DRV8214_I2C_ERROR) { drv8214_i2c_recovery_pending = true; }
+}
+
+// --- Transaction Trace ---
+// Every transfer made through DRV8214_RegisterAccess, whatever the bus policy, can be recorded into a byte ring:
+// timestamp, address, first register, direction, result, retries and the register bytes (what was written, or what the
+// driver got back). Recording is off until drv8214_i2c_trace_start(), then costs one record copy per transfer.
+// Compiled in by default on Linux only: on an MCU the ring would take DRV8214_I2C_TRACE_RING_SIZE bytes of RAM, build
+// with -DDRV8214_I2C_TRACE=1 to trace there. DRV8214_I2C_TRACE=0 compiles the hook and the ring out. Drained records are self-delimiting, a trace file is the header from
+// drv8214_i2c_trace_header() followed by the drained bytes, see tools/drv8214_trace_replay.cpp and drv8214_trace_diff.cpp.
+// Serialized record: timestamp_us (uint32 LE), address, reg, flags, length, then length data bytes.
+#ifndef DRV8214_I2C_TRACE
+    #ifdef DRV8214_PLATFORM_LINUX
+        #define DRV8214_I2C_TRACE  1
+    #else
+        #define DRV8214_I2C_TRACE  0
+    #endif
+#endif
+#ifndef DRV8214_I2C_TRACE_RING_SIZE
+    #define DRV8214_I2C_TRACE_RING_SIZE  4096  // Bytes, must be a power of two
+#endif
+#define DRV8214_I2C_TRACE_VERSION       1
+#define DRV8214_I2C_TRACE_HEADER_BYTES  5     // "D8IT" and the version
+#define DRV8214_I2C_TRACE_RECORD_BYTES  8     // Serialized record without its data
+#define DRV8214_I2C_TRACE_MAX_DATA      32    // DRV8214_BUS_MAX_BURST
+
+// Record flags
+#define DRV8214_I2C_TRACE_READ          0x01  // Bit 0 - Read transfer (0: write)
+#define DRV8214_I2C_TRACE_RESULT        0x06  // Bits 2-1 - DRV8214_I2C_* result of the last attempt
+#define DRV8214_I2C_TRACE_RETRIES       0xF8  // Bits 7-3 - Attempts repeated after a failure, saturated at 31
+
+// Retry field of a transfer repeated 31 times or more (drv8214_i2c_set_retries() above 30): the exact count is lost,
+// the replay and diff tools report it as saturated
+#define DRV8214_I2C_TRACE_RETRIES_SATURATED  31
+
+struct DRV8214_I2CTraceRecord {
+    uint32_t timestamp_us;   // Trace clock when the transfer completed
+    uint8_t  address;
+    uint8_t  reg;
+    uint8_t  flags;
+    uint8_t  length;
+    uint8_t  data[DRV8214_I2C_TRACE_MAX_DATA];
+};
+
+#if DRV8214_I2C_TRACE
+
+extern bool drv8214_i2c_trace_enabled;
+
+void     drv8214_i2c_trace_start(uint32_t (*clock)() = nullptr); // Timestamps from clock, drv8214_time_micros() by default
+void     drv8214_i2c_trace_stop();
+void     drv8214_i2c_trace_record(uint8_t address, uint8_t reg, bool read, const uint8_t* data, uint8_t length, uint8_t result, uint8_t retries);
+uint32_t drv8214_i2c_trace_drain(uint8_t* out, uint32_t max_bytes); // Moves whole serialized records out, returns the bytes written
+uint32_t drv8214_i2c_trace_dropped();                               // Records lost because the ring was full
+uint8_t  drv8214_i2c_trace_header(uint8_t* out);                    // Trace file header, returns its length
+bool     drv8214_i2c_trace_check_header(const uint8_t* data, size_t length);
+size_t   drv8214_i2c_trace_parse(const uint8_t* data, size_t length, DRV8214_I2CTraceRecord& record); // Bytes consumed, 0 if truncated
+
+inline void drv8214_i2c_trace(uint8_t address, uint8_t reg, bool read, const uint8_t* data, uint8_t length, uint8_t result, uint8_t retries) {
+    if (drv8214_i2c_trace_enabled) { drv8214_i2c_trace_record(address, reg, read, data, length, result, retries); }
+}
+
+#else
+
+inline void     drv8214_i2c_trace_start(uint32_t (*clock)() = nullptr) { (void)clock; }
+inline void     drv8214_i2c_trace_stop() { }
+inline uint32_t drv8214_i2c_trace_drain(uint8_t* out, uint32_t max_bytes) { (void)out; (void)max_bytes; return 0; }
+inline uint32_t drv8214_i2c_trace_dropped() { return 0; }
+inline void     drv8214_i2c_trace(uint8_t address, uint8_t reg, bool read, const uint8_t* data, uint8_t length, uint8_t result, uint8_t retries) {
+    (void)address; (void)reg; (void)read; (void)data; (void)length; (void)result; (void)retries;
+}
+
+#endif
+
+// Common I2C function declarations, with retries and accounting. Reads return 0 in the data on failure.
+uint8_t drv8214_i2c_write_register(uint8_t device_address, uint8_t reg, uint8_t value);
+uint8_t drv8214_i2c_read_register(uint8_t device_address, uint8_t reg, uint8_t* value);
+uint8_t drv8214_i2c_write_registers(uint8_t device_address, uint8_t reg, const uint8_t* data, uint8_t length); // Burst write of consecutive registers
+uint8_t drv8214_i2c_read_registers(uint8_t device_address, uint8_t reg, uint8_t* data, uint8_t length); // Burst read of consecutive registers
+uint8_t drv8214_i2c_modify_register(uint8_t device_address, uint8_t reg, uint8_t mask, uint8_t enable_bits); // Changed bool to uint8_t
+uint8_t drv8214_i2c_modify_register_bits(uint8_t device_address, uint8_t reg, uint8_t mask, uint8_t new_value);
+
+// Single attempt on the native backend, no retry nor accounting. Used by DRV8214_PlatformBus.
+uint8_t drv8214_i2c_try_write_registers(uint8_t device_address, uint8_t reg, const uint8_t* data, uint8_t length);
+uint8_t drv8214_i2c_try_read_registers(uint8_t device_address, uint8_t reg, uint8_t* data, uint8_t length);
 
 #endif // DRV8214_PLATFORM_I2C_H
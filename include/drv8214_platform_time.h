@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// DRV8214_Driver/Inc/drv8214_platform_time.h
+#ifndef DRV8214_PLATFORM_TIME_H
+#define DRV8214_PLATFORM_TIME_H
+
+#include "drv8214_platform_config.h" // For platform detection
+
+#ifdef DRV8214_PLATFORM_STM32
+    #include "stm32wbxx_hal.h" // This should be the main HAL include for your MCU. Can be found in main.h
+#endif
+
+// Common time function declarations, all counters wrap around at 2^32
+uint32_t drv8214_time_millis();
+uint32_t drv8214_time_micros();
+void drv8214_time_delay_ms(uint32_t ms);
+
+#endif // DRV8214_PLATFORM_TIME_H
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Register map descriptors and the generic services built on them: field-decoded dump, diff against an expected
+// image and validation. Images are DRV8214_REG_COUNT bytes, FAULT (0x00) to RC_CTRL8 (0x19), as returned by
+// DRV8214::readRegisters(). The compact binary form of a diagnostic is the image itself and the DRV8214_FieldDiff
+// records (4 bytes each), the text form is produced line by line through a print callback.
+#ifndef DRV8214_REGMAP_H
+#define DRV8214_REGMAP_H
+
+#include "DRV8214.h"
+
+#define DRV8214_RO  0  // Status register, read only
+#define DRV8214_RW  1  // Configuration register
+
+// Validation results, combined in the value returned by drv8214_regmap_validate()
+#define DRV8214_CHECK_RESERVED   0x01  // Reserved bits set in a configuration register
+#define DRV8214_CHECK_INV_R      0x02  // Ripple counting enabled with INV_R = 0
+#define DRV8214_CHECK_KMC        0x04  // Ripple counting enabled with KMC = 0
+#define DRV8214_CHECK_SPEED_RC   0x08  // Speed regulation selected without ripple counting
+#define DRV8214_CHECK_THRESHOLD  0x10  // Outputs released at a ripple threshold of 0 (RC_HIZ set, RC_THR = 0)
+
+struct DRV8214_RegisterDesc {
+    uint8_t     address;
+    uint8_t     access;   // DRV8214_RO or DRV8214_RW
+    uint8_t     reset;    // Power-on reset value
+    uint8_t     reserved; // Reserved bits, read as 0
+    const char* name;
+};
+
+struct DRV8214_FieldDesc {
+    uint8_t     reg;      // Register address
+    uint8_t     mask;     // Field bits in the register
+    const char* name;
+};
+
+// One field, or the bits outside any field, that differ between two images
+struct DRV8214_FieldDiff {
+    uint8_t reg;          // Register address
+    uint8_t mask;         // Bits compared, the mask of a field when it is a named one
+    uint8_t expected;     // Expected register bits under mask
+    uint8_t actual;       // Register bits read under mask
+};
+
+// Registers with their access and reserved bits. 0x07 and 0x08 are reserved addresses and not listed.
+#define DRV8214_REGISTERS(X) \
+    X(FAULT, RO, FAULT_RSVD) X(RC_STATUS1, RO, 0x00) X(RC_STATUS2, RO, 0x00) X(RC_STATUS3, RO, 0x00) \
+    X(REG_STATUS1, RO, 0x00) X(REG_STATUS2, RO, 0x00) X(REG_STATUS3, RO, REG_STATUS3_RSVD) \
+    X(CONFIG0, RW, 0x00) X(CONFIG1, RW, 0x00) X(CONFIG2, RW, 0x00) X(CONFIG3, RW, 0x00) X(CONFIG4, RW, 0x00) \
+    X(REG_CTRL0, RW, REG_CTRL0_RSVD) X(REG_CTRL1, RW, 0x00) X(REG_CTRL2, RW, 0x00) \
+    X(RC_CTRL0, RW, 0x00) X(RC_CTRL1, RW, 0x00) X(RC_CTRL2, RW, 0x00) X(RC_CTRL3, RW, 0x00) X(RC_CTRL4, RW, 0x00) \
+    X(RC_CTRL5, RW, RC_CTRL5_FLT_RSVD) X(RC_CTRL6, RW, 0x00) X(RC_CTRL7, RW, 0x00) X(RC_CTRL8, RW, 0x00)
+
+#define DRV8214_REGISTER_DESC(reg, access, reserved) { DRV8214_##reg, DRV8214_##access, drv8214_reset_value(DRV8214_##reg), reserved, #reg },
+constexpr DRV8214_RegisterDesc DRV8214_REGISTER_TABLE[] = { DRV8214_REGISTERS(DRV8214_REGISTER_DESC) };
+#undef DRV8214_REGISTER_DESC
+
+#define DRV8214_FIELD_DESC(reg, name) { DRV8214_##reg, reg##_##name, #name },
+constexpr DRV8214_FieldDesc DRV8214_FIELD_TABLE[] = { DRV8214_FIELDS(DRV8214_FIELD_DESC) };
+#undef DRV8214_FIELD_DESC
+
+#define DRV8214_REGISTER_TABLE_SIZE  (sizeof(DRV8214_REGISTER_TABLE) / sizeof(DRV8214_REGISTER_TABLE[0]))
+#define DRV8214_FIELD_TABLE_SIZE     (sizeof(DRV8214_FIELD_TABLE) / sizeof(DRV8214_FIELD_TABLE[0]))
+
+static_assert(DRV8214_REGISTER_TABLE_SIZE == DRV8214_REG_COUNT - 2, "Every register but the two reserved addresses is described");
+
+typedef void (*DRV8214_PrintCallback)(const char* line, void* context);
+
+// --- Lookup ---
+const DRV8214_RegisterDesc* drv8214_regmap_register(uint8_t address); // nullptr for reserved addresses
+const DRV8214_FieldDesc*    drv8214_regmap_field(uint8_t address, uint8_t mask); // nullptr if the bits are not a named field
+
+// --- Services ---
+// Fields of the RW registers that differ, in address order. Returns the number of differences, diffs holds the first max_diffs.
+uint8_t drv8214_regmap_diff(const uint8_t* actual, const uint8_t* expected, DRV8214_FieldDiff* diffs, uint8_t max_diffs);
+uint8_t drv8214_regmap_validate(const uint8_t* image); // DRV8214_CHECK_* flags, 0 if the image is consistent
+
+// --- Text Output ---
+void drv8214_regmap_print_dump(const uint8_t* image, DRV8214_PrintCallback print, void* context);
+void drv8214_regmap_print_diff(const DRV8214_FieldDiff* diffs, uint8_t count, DRV8214_PrintCallback print, void* context);
+void drv8214_regmap_print_checks(uint8_t checks, DRV8214_PrintCallback print, void* context);
+
+#endif // DRV8214_REGMAP_H
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Host-side software ripple detector, used to cross-check the DRV8214 internal ripple counter
+// (RC_STATUS2/3) against captured motor current waveforms. Platform independent, no I2C access.
+#ifndef DRV8214_RIPPLE_DSP_H
+#define DRV8214_RIPPLE_DSP_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define DRV8214_RIPPLE_BLOCK_SIZE 256  // Number of samples processed per inner block
+
+struct DRV8214_RippleDetectorConfig {
+    float sample_rate_hz = 20000.0f;      // Sampling rate of the captured current waveform in Hz
+    float low_cut_hz = 40.0f;             // Lower edge of the ripple band-pass in Hz (removes DC and load variations)
+    float high_cut_hz = 2500.0f;          // Upper edge of the ripple band-pass in Hz (removes PWM and switching noise)
+    float threshold_ratio = 0.6f;         // Peak threshold as a fraction of the running RMS of the filtered signal
+    float min_peak_amplitude = 0.002f;    // Absolute peak threshold in A, avoids counting noise while the motor is stopped
+    float min_ripple_period_s = 0.0004f;  // Minimum time between two ripples in s (highest expected ripple frequency)
+    float envelope_time_s = 0.02f;        // Time constant of the running RMS used for the adaptive threshold in s
+};
+
+// Second order IIR section, direct form II transposed
+struct DRV8214_Biquad {
+    float b0, b1, b2, a1, a2;  // Normalized coefficients (a0 = 1)
+    float z1, z2;              // Filter state
+};
+
+class DRV8214RippleDetector {
+
+    private:
+        DRV8214_RippleDetectorConfig config;
+
+        DRV8214_Biquad highpass;            // Band-pass lower edge
+        DRV8214_Biquad lowpass;             // Band-pass upper edge
+        float    envelope;                  // Running RMS of the filtered signal
+        float    envelope_alpha;            // Smoothing factor of the running RMS, per block of samples
+        uint32_t min_period_samples;        // Refractory period between two ripples in samples
+        uint32_t samples_since_peak;        // Samples elapsed since the last detected ripple
+        uint64_t ripple_count;              // Number of ripples detected since the last reset
+        uint64_t sample_count;              // Number of samples processed since the last reset
+
+        float    filtered[DRV8214_RIPPLE_BLOCK_SIZE + 2];  // Two history samples followed by the filtered block
+        uint8_t  candidates[DRV8214_RIPPLE_BLOCK_SIZE];    // Peak candidates of the current block
+
+        // Private functions
+        void processBlock(const float* samples, size_t count);
+
+    public:
+        // Constructor
+        DRV8214RippleDetector() { init(DRV8214_RippleDetectorConfig()); }
+        explicit DRV8214RippleDetector(const DRV8214_RippleDetectorConfig& cfg) { init(cfg); }
+
+        // Initialization
+        void init(const DRV8214_RippleDetectorConfig& cfg);
+        void reset();
+
+        // --- Processing Functions ---
+        uint32_t process(const float* samples, size_t count);
+        uint32_t process(const uint8_t* current_registers, size_t count, float max_current);
+
+        // --- Helper Functions ---
+        uint64_t getRippleCount() const { return ripple_count; }
+        uint64_t getSampleCount() const { return sample_count; }
+        float    getEnvelope() const { return envelope; }
+};
+
+// Compares the software ripple count with the 16-bit hardware counter of one driver
+class DRV8214RippleCrossCheck {
+
+    private:
+        uint8_t  driver_ID;             // ID of the driver being checked
+        uint16_t last_hw_count;         // Last RC_STATUS3:RC_STATUS2 value seen
+        uint64_t hw_total;              // Hardware ripples accumulated since begin(), wrap-around compensated
+        uint64_t sw_total;              // Software ripples accumulated since begin()
+        uint32_t tolerance_ripples;     // Absolute drift tolerated before flagging a miscount
+        float    tolerance_ratio;       // Relative drift tolerated before flagging a miscount
+
+    public:
+        // Constructor
+        DRV8214RippleCrossCheck(uint8_t id = 0, uint32_t tol_ripples = 2, float tol_ratio = 0.01f) : driver_ID(id), last_hw_count(0), hw_total(0), sw_total(0), tolerance_ripples(tol_ripples), tolerance_ratio(tol_ratio) {}
+
+        void begin(uint16_t hw_count);
+        void update(uint32_t sw_ripples, uint16_t hw_count);
+        void resynchronize(uint16_t hw_count);
+
+        // --- Helper Functions ---
+        uint8_t  getDriverID() const { return driver_ID; }
+        uint64_t getHardwareCount() const { return hw_total; }
+        uint64_t getSoftwareCount() const { return sw_total; }
+        int64_t  getDrift() const { return (int64_t)hw_total - (int64_t)sw_total; }
+        float    getDriftRatio() const;
+        bool     isMiscounting() const;
+};
+
+#endif // DRV8214_RIPPLE_DSP_H
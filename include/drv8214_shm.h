@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Status ring in a memory-mapped file (Linux), so any number of processes (logger, UI, analytics) follow the drivers
+// without touching the I2C bus. One publisher writes, readers map the file read-only and never write to it: they
+// cannot slow the publisher down nor each other, a reader that falls behind by more than the ring loses the oldest
+// records and is told how many.
+//
+// Layout: a 64-byte header, then a power-of-two number of 32-byte records. Each record carries its own sequence
+// number, used as a seqlock: odd while the publisher writes the record, 2 * (n + 1) once record n is complete.
+// A reader accepts record n only when the sequence reads the same before and after it looked at the record.
+//
+//   DRV8214ShmPublisher publisher;                  DRV8214ShmReader reader;
+//   publisher.open("/dev/shm/drv8214", 4096);       reader.open("/dev/shm/drv8214");
+//   publisher.publish(id, status, position, t);     while (const DRV8214_ShmRecord* r = reader.peek()) {
+//                                                       use(*r);                 // Straight from the mapping
+//                                                       if (!reader.consume()) { discard(); } // Overwritten meanwhile
+//                                                   }
+// A publisher restart creates a new file, readers of the previous one stop receiving and must reopen.
+#ifndef DRV8214_SHM_H
+#define DRV8214_SHM_H
+
+#include "DRV8214.h"
+
+#ifdef DRV8214_PLATFORM_LINUX
+
+#define DRV8214_SHM_MAGIC    0x48533844u  // "D8SH"
+#define DRV8214_SHM_VERSION  1
+
+struct DRV8214_ShmHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t record_bytes;       // sizeof(DRV8214_ShmRecord)
+    uint32_t capacity;           // Records in the ring, power of two
+    uint32_t reserved;
+    uint64_t head;               // Records published so far, the next one is head
+    uint8_t  padding[40];        // Keeps the records on their own cache lines
+};
+
+struct DRV8214_ShmRecord {
+    uint64_t       sequence;     // Seqlock, 2 * (n + 1) once record n is complete, odd while it is written
+    uint32_t       timestamp_us; // drv8214_time_micros() of the snapshot
+    uint8_t        driver_id;
+    uint8_t        reserved[3];
+    DRV8214_Status status;       // Raw status registers
+    int32_t        position;     // Position in ripples
+    uint32_t       reserved2;
+};
+
+static_assert(sizeof(DRV8214_ShmHeader) == 64, "The records start on a cache line");
+static_assert(sizeof(DRV8214_ShmRecord) == 32, "Two records per cache line");
+
+class DRV8214ShmPublisher {
+
+    private:
+        DRV8214_ShmHeader* header = nullptr;
+        DRV8214_ShmRecord* records = nullptr;
+        size_t   mapped_bytes = 0;
+        uint64_t head = 0;       // Private copy of header->head, the publisher is its only writer
+
+    public:
+        ~DRV8214ShmPublisher() { close(); }
+
+        // Replaces the file at path by a new, empty ring. capacity must be a power of two. false with errno set on failure.
+        bool open(const char* path, uint32_t capacity);
+        void close();
+        void publish(uint8_t driver_id, const DRV8214_Status& status, int32_t position, uint32_t timestamp_us);
+
+        // --- Helper Functions ---
+        uint64_t getPublished() const { return head; }
+};
+
+class DRV8214ShmReader {
+
+    private:
+        const DRV8214_ShmHeader* header = nullptr;
+        const DRV8214_ShmRecord* records = nullptr;
+        size_t   mapped_bytes = 0;
+        uint32_t mask = 0;
+        uint64_t next = 0;       // Sequence of the next record to read
+        uint64_t peeked = 0;     // Slot sequence seen by peek(), 0 when nothing is peeked
+        uint64_t lost = 0;       // Records overwritten before this reader got to them
+
+    public:
+        ~DRV8214ShmReader() { close(); }
+
+        // Maps the ring read-only and starts at its newest record (from_oldest: at the oldest one still held)
+        bool open(const char* path, bool from_oldest = false);
+        void close();
+
+        // Zero-copy access: the next complete record, in the mapping, or nullptr when there is none yet.
+        // consume() moves on, it returns false when the publisher overwrote the record while it was being used.
+        const DRV8214_ShmRecord* peek();
+        bool consume();
+        // Copying access: true when record holds the next record, complete and consistent
+        bool read(DRV8214_ShmRecord& record);
+
+        // --- Helper Functions ---
+        uint64_t getNext() const { return next; }
+        uint64_t getLost() const { return lost; }
+        uint64_t getAvailable() const;  // Records published but not read yet
+};
+
+#endif // DRV8214_PLATFORM_LINUX
+
+#endif // DRV8214_SHM_H
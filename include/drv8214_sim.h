@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Register-level DRV8214 simulator with a simple motor model, reachable through DRV8214_SimBus.
+// Meant for host-side development and replay: select it with -DDRV8214_BUS_POLICY=DRV8214_SimBus.
+#ifndef DRV8214_SIM_H
+#define DRV8214_SIM_H
+
+#include "DRV8214.h"
+
+#define DRV8214_SIM_REG_COUNT    DRV8214_REG_COUNT
+#define DRV8214_SIM_MAX_DEVICES  16    // Simulated devices that can be attached at the same time
+#define DRV8214_SIM_BUS_HZ       400000 // SCL frequency used to account the simulated bus time
+
+struct DRV8214_SimMotor {
+    float free_ripple_rate = 2000.0f;    // Ripples per second when driven without speed regulation
+    float ripples_per_volt = 500.0f;     // Ripples per second per volt in voltage regulation
+    float supply_voltage = 3.0f;         // Voltage applied to the motor terminals while driving in V
+    float running_current = 0.1f;        // Current drawn while running in A
+    float stall_current = 0.5f;          // Current drawn against a hard stop in A
+    int32_t stop_min = INT32_MIN;        // Motor position of the reverse hard stop in ripples
+    int32_t stop_max = INT32_MAX;        // Motor position of the forward hard stop in ripples
+};
+
+// Faults injected by DRV8214_SimBus, drawn independently for every attempt from a seeded generator
+struct DRV8214_SimBusFaults {
+    float    nack_rate = 0.0f;           // Probability that an attempt is not acknowledged
+    float    timeout_rate = 0.0f;        // Probability that an attempt hangs until drv8214_i2c_timeout_ms
+    uint32_t seed = 1;                   // Generator seed, the same seed gives the same fault sequence
+};
+
+class DRV8214Sim {
+
+    private:
+        uint8_t  address;                    // I2C address the device answers to
+        uint8_t  regs[DRV8214_SIM_REG_COUNT];
+        DRV8214_SimMotor motor;
+        int32_t  position;                   // True motor position in ripples
+        float    ripple_phase;               // Fractional ripple not yet counted
+        bool     hiz_latched;                // Outputs released after reaching the ripple threshold (RC_HIZ)
+        bool     stall_latched;              // Outputs released after a stall (SMODE = 0)
+        bool     real_time;                  // Advance the model with drv8214_time_micros() on each access
+        uint32_t last_access_us;
+
+        // Private functions
+        int8_t driveDirection() const;
+        float  rippleRate() const;
+        void   sync();
+
+    public:
+        // Constructor
+        DRV8214Sim(uint8_t addr = DRV8214_I2C_ADDR_00, const DRV8214_SimMotor& m = DRV8214_SimMotor());
+
+        // --- Bus Side ---
+        void write(uint8_t reg, const uint8_t* data, uint8_t length);
+        void read(uint8_t reg, uint8_t* data, uint8_t length);
+
+        // --- Test Bench Side ---
+        void     powerOnReset();
+        void     step(uint32_t dt_us);
+        void     setRealTime(bool enable);
+        void     setMotor(const DRV8214_SimMotor& m) { motor = m; }
+        uint8_t  getRegister(uint8_t reg) const { return reg < DRV8214_SIM_REG_COUNT ? regs[reg] : 0; }
+        void     setRegister(uint8_t reg, uint8_t value) { if (reg < DRV8214_SIM_REG_COUNT) { regs[reg] = value; } }
+        uint8_t  getAddress() const { return address; }
+        int32_t  getPosition() const { return position; }
+        bool     isDriving() const { return driveDirection() != 0; }
+};
+
+// Registry used by DRV8214_SimBus to route transactions to simulated devices
+bool        drv8214_sim_attach(DRV8214Sim* device);
+void        drv8214_sim_detach(DRV8214Sim* device);
+DRV8214Sim* drv8214_sim_find(uint8_t address);
+
+// Fault injection and bus time accounting of DRV8214_SimBus
+void     drv8214_sim_bus_set_faults(const DRV8214_SimBusFaults& faults);
+uint64_t drv8214_sim_bus_time_us();      // Bus time spent so far: transfers at DRV8214_SIM_BUS_HZ, NACKs, full timeouts
+void     drv8214_sim_bus_reset_time();
+
+// Stuck bus: a device holds SDA low until it sees the given number of SCL clocks (1 to 9, 0 frees the bus).
+// Every attempt times out meanwhile. The hooks drive the simulated lines for drv8214_i2c_recover_bus().
+void     drv8214_sim_bus_stick(uint8_t clocks_to_release);
+bool     drv8214_sim_bus_stuck();
+DRV8214_BusRecoveryHooks drv8214_sim_bus_recovery_hooks();
+
+#endif // DRV8214_SIM_H
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Compact binary telemetry stream for continuous status logging, one writer per driver.
+// Samples are buffered column by column and encoded a block at a time. Blocks of several drivers can share a stream.
+//
+// Stream : "D8TL", format version
+// Block  : marker 0xD8, driver ID, sample count, payload length (uint16 LE), then the 7 columns in this order:
+//          timestamp_us, fault, ripple_count, speed, voltage, current, duty
+// Column : first value as an unsigned LEB128 varint
+//          mode byte: bit 7 set for second-order deltas (delta of delta), bits 5-0 = width in bits
+//          count - 1 zigzag residuals bit-packed LSB first at that width, padded to a byte
+// Residuals wrap at the width of the field (32, 16 or 8 bits), so counter roll-overs cost nothing.
+// The writer picks the order per column and per block. A steady poll period or motor speed gives second-order
+// residuals of 0, and a column that does not change in a block has width 0 and takes two bytes in total.
+// Readers reject blocks longer than their own DRV8214_TELEMETRY_BLOCK.
+#ifndef DRV8214_TELEMETRY_H
+#define DRV8214_TELEMETRY_H
+
+#include "DRV8214.h"
+
+#ifndef DRV8214_TELEMETRY_BLOCK
+    #define DRV8214_TELEMETRY_BLOCK  64  // Samples per block, at most 255. A writer holds about 23 bytes per sample.
+#endif
+
+#define DRV8214_TELEMETRY_VERSION        1
+#define DRV8214_TELEMETRY_HEADER_BYTES   5     // "D8TL" and the version
+#define DRV8214_TELEMETRY_BLOCK_MARKER   0xD8
+#define DRV8214_TELEMETRY_COLUMNS        7
+// Largest encoded block: block header, then per column a 5-byte varint, the mode byte and 32 + 16 + 5 * 8 bits per residual
+#define DRV8214_TELEMETRY_MAX_BLOCK_BYTES (5 + DRV8214_TELEMETRY_COLUMNS * 6 + 11 * (DRV8214_TELEMETRY_BLOCK - 1))
+
+static_assert(DRV8214_TELEMETRY_BLOCK >= 1 && DRV8214_TELEMETRY_BLOCK <= 255, "The sample count of a block is stored in one byte");
+
+// One block of one driver, column by column
+struct DRV8214_TelemetryBlock {
+    uint8_t  driver_id;
+    uint8_t  count;                                    // Samples held
+    uint32_t timestamp_us[DRV8214_TELEMETRY_BLOCK];
+    uint8_t  fault[DRV8214_TELEMETRY_BLOCK];
+    uint16_t ripple_count[DRV8214_TELEMETRY_BLOCK];
+    uint8_t  speed[DRV8214_TELEMETRY_BLOCK];
+    uint8_t  voltage[DRV8214_TELEMETRY_BLOCK];
+    uint8_t  current[DRV8214_TELEMETRY_BLOCK];
+    uint8_t  duty[DRV8214_TELEMETRY_BLOCK];
+};
+
+// Receives every encoded block (UART, file, ring buffer). The data is only valid during the call.
+typedef void (*DRV8214_TelemetrySink)(const uint8_t* data, uint16_t length, void* context);
+
+class DRV8214TelemetryWriter {
+
+    private:
+        DRV8214_TelemetrySink sink;
+        void*    context;
+        uint32_t bytes_written;                        // Encoded bytes handed to the sink
+        DRV8214_TelemetryBlock pending;                // Samples of the block being filled
+        uint8_t  encoded[DRV8214_TELEMETRY_MAX_BLOCK_BYTES];
+
+    public:
+        // Constructor
+        DRV8214TelemetryWriter(uint8_t driver_id, DRV8214_TelemetrySink block_sink, void* sink_context)
+            : sink(block_sink), context(sink_context), bytes_written(0) { pending.driver_id = driver_id; pending.count = 0; }
+
+        void add(const DRV8214_Status& status, uint32_t timestamp_us); // Encodes and hands over the block once it is full
+        void flush();                                                   // Encodes the samples pending, if any
+
+        // --- Helper Functions ---
+        uint8_t  getPendingSamples() const { return pending.count; }
+        uint32_t getBytesWritten() const { return bytes_written; }
+};
+
+// --- Encoding ---
+uint8_t  drv8214_telemetry_header(uint8_t* out);                                     // Writes the stream header, returns its length
+uint16_t drv8214_telemetry_encode_block(const DRV8214_TelemetryBlock& block, uint8_t* out); // Returns the encoded length
+
+// --- Decoding ---
+bool   drv8214_telemetry_check_header(const uint8_t* data, size_t length);
+// Decodes the block at the start of data. Returns the bytes consumed, 0 when the block is truncated or malformed.
+size_t drv8214_telemetry_decode_block(const uint8_t* data, size_t length, DRV8214_TelemetryBlock& block);
+// Sample i of a block as a CSV row "timestamp_us,driver,fault,ripple_count,speed,voltage,current,duty\n", without
+// snprintf. Returns the row length, 0 if it does not fit. DRV8214_TELEMETRY_CSV_HEADER is the matching header line.
+#define DRV8214_TELEMETRY_CSV_HEADER   "timestamp_us,driver,fault,ripple_count,speed,voltage,current,duty\n"
+#define DRV8214_TELEMETRY_CSV_MAX_ROW  48
+size_t drv8214_telemetry_format_csv(const DRV8214_TelemetryBlock& block, uint8_t i, char* buffer, size_t length);
+
+#endif // DRV8214_TELEMETRY_H
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Timeline of the public DRV8214 calls and of the register transfers, exported as Chrome trace JSON (chrome://tracing,
+// ui.perfetto.dev). Each call is a span on the track of its driver (tid = driver ID), each transfer and read-modify-write
+// sequence a span on the bus track, so overlapping calls, bus holding times and jitter show up side by side.
+// Spans are stored in a preallocated buffer of DRV8214_TIMELINE_EVENTS entries, recording stops when it is full.
+//
+// Enable with -DDRV8214_TIMELINE=1. Disabled (the default), the scopes and the buffer compile to nothing and the
+// functions below are empty inline stubs, so the application code needs no #if.
+#ifndef DRV8214_TIMELINE_H
+#define DRV8214_TIMELINE_H
+
+#include "drv8214_platform_config.h" // For platform detection
+#include "drv8214_platform_time.h"
+#include <stddef.h>
+
+#ifndef DRV8214_TIMELINE
+    #define DRV8214_TIMELINE  0
+#endif
+#ifndef DRV8214_TIMELINE_EVENTS
+    #define DRV8214_TIMELINE_EVENTS  4096  // Spans held by the buffer, 16 bytes each on 32-bit targets
+#endif
+
+#define DRV8214_TIMELINE_BUS_TRACK  256   // tid of the register transfers, driver IDs use 0 to 255
+
+// Receives the JSON text in chunks
+typedef void (*DRV8214_TimelineWriter)(const char* text, size_t length, void* context);
+
+struct DRV8214_TimelineEvent {
+    const char* name;        // Static string: method name, "read", "write", "read-modify-write"
+    uint32_t    start_us;
+    uint32_t    duration_us;
+    uint16_t    track;       // Driver ID, or DRV8214_TIMELINE_BUS_TRACK
+    uint8_t     address;     // I2C address of the driver
+    uint8_t     reg;         // Transfers: first register and length, 0 for the calls
+    uint8_t     length;
+    uint8_t     result;      // Transfers: DRV8214_I2C_* result
+};
+
+#if DRV8214_TIMELINE
+
+extern bool drv8214_timeline_enabled;
+extern uint32_t (*drv8214_timeline_clock)();
+
+void     drv8214_timeline_start(uint32_t (*clock)() = nullptr); // Timestamps from clock, drv8214_time_micros() by default
+void     drv8214_timeline_stop();
+void     drv8214_timeline_clear();
+void     drv8214_timeline_push(const DRV8214_TimelineEvent& event);
+uint32_t drv8214_timeline_count();
+uint32_t drv8214_timeline_dropped();   // Spans lost because the buffer was full
+const DRV8214_TimelineEvent* drv8214_timeline_events();
+void     drv8214_timeline_dump_json(DRV8214_TimelineWriter write, void* context);
+
+// Span from construction to destruction, recorded only if the timeline was running when it opened
+struct DRV8214_TimelineScope {
+    DRV8214_TimelineEvent event;
+    bool active;
+
+    DRV8214_TimelineScope(const char* name, uint16_t track, uint8_t address, uint8_t reg = 0, uint8_t length = 0) : active(drv8214_timeline_enabled) {
+        if (!active) { return; }
+        event.name = name;
+        event.track = track;
+        event.address = address;
+        event.reg = reg;
+        event.length = length;
+        event.result = 0;
+        event.start_us = drv8214_timeline_clock();
+    }
+    ~DRV8214_TimelineScope() {
+        if (!active) { return; }
+        event.duration_us = drv8214_timeline_clock() - event.start_us;
+        drv8214_timeline_push(event);
+    }
+};
+
+    #define DRV8214_TIMELINE_SCOPE(scope, ...)     DRV8214_TimelineScope scope(__VA_ARGS__)
+    #define DRV8214_TIMELINE_RESULT(scope, value)  (scope.event.result = (value))
+
+#else
+
+inline void     drv8214_timeline_start(uint32_t (*clock)() = nullptr) { (void)clock; }
+inline void     drv8214_timeline_stop() { }
+inline void     drv8214_timeline_clear() { }
+inline uint32_t drv8214_timeline_count() { return 0; }
+inline uint32_t drv8214_timeline_dropped() { return 0; }
+inline const DRV8214_TimelineEvent* drv8214_timeline_events() { return nullptr; }
+inline void     drv8214_timeline_dump_json(DRV8214_TimelineWriter write, void* context) { (void)write; (void)context; }
+
+    #define DRV8214_TIMELINE_SCOPE(scope, ...)     do { } while (0)
+    #define DRV8214_TIMELINE_RESULT(scope, value)  do { } while (0)
+
+#endif
+
+#endif // DRV8214_TIMELINE_H
@@ -6,14 +6,84 @@
  * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
  */
 
-#include "drv8214.h"
+#include "DRV8214.h"
+#include "drv8214_regmap.h"
+#include <stdarg.h>
+
+// Instrumentation of a public call: timeline span on the track of its driver and, for the entry points, latency
+// histogram of the method for this driver. Nothing unless DRV8214_TIMELINE or DRV8214_LATENCY is set.
+#define DRV8214_API_SCOPE() \
+    DRV8214_TIMELINE_SCOPE(api_span, __func__, driver_ID, address); \
+    DRV8214_LATENCY_SCOPE(api_latency, latency_slots, latency_depth, driver_ID, __func__)
+
+// Bits that belong to the motion in progress rather than to the configuration (bridge state, direction, target, threshold)
+static const uint8_t drv_motion_bits[DRV8214_CONFIG_COUNT] = {
+    CONFIG0_EN_OUT,                                             // CONFIG0
+    0x00, 0x00, 0x00,                                           // CONFIG1 - CONFIG3
+    CONFIG4_I2C_EN_IN1 | CONFIG4_I2C_PH_IN2,                    // CONFIG4
+    0x00, 0xFF, 0x00,                                           // REG_CTRL0 - REG_CTRL2
+    RC_CTRL0_RC_HIZ, 0xFF, RC_CTRL2_RC_THR_HIGH | RC_CTRL2_RC_THR_SCALE, // RC_CTRL0 - RC_CTRL2
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00                          // RC_CTRL3 - RC_CTRL8
+};
+
+// FNV-1a over the configuration bits of an image
+static uint32_t drv_image_hash(const uint8_t* image) {
+    uint32_t hash = 2166136261u;
+    for (uint8_t i = 0; i < DRV8214_CONFIG_COUNT; i++) {
+        hash = (hash ^ (uint8_t)(image[i] & ~drv_motion_bits[i])) * 16777619u;
+    }
+    return hash;
+}
 
 // Initialize the motor driver with default settings
-uint8_t DRV8214::init(const DRV8214_Config& cfg) {
+uint8_t DRV8214::init(const DRV8214_Config& config) {
+    DRV8214_API_SCOPE();
+
+    // Only the log flag is kept, the configuration itself ends up in the shadow image
+    verbose = config.verbose;
+    uint16_t errors = bus_errors;
+    npor_events = 0;
+    scrub_repairs = 0;
+    soft_limit_saved = false; // The image is seeded again below
+
+    // Status and configuration in one burst: after an MCU restart the device may still hold our image and be moving
+    uint8_t live[DRV8214_REG_COUNT];
+    bool configured = false;
+    shadow_valid = (regReadBurst(DRV8214_FAULT, live, sizeof(live)) == DRV8214_OK);
+    if (shadow_valid) {
+        const uint8_t* device = live + DRV8214_CONFIG0;
+        memcpy(shadow, device, DRV8214_CONFIG_COUNT);
+        dryRunConfiguration(config); // The shadow now holds the image the init sequence would leave
+        if (!(live[DRV8214_FAULT] & FAULT_NPOR) && drv_image_hash(shadow) == drv_image_hash(device)) {
+            // Warm start: nothing to write, adopt the ripple count and the motion in progress
+            memcpy(shadow, device, DRV8214_CONFIG_COUNT);
+            last_ripple_count = (live[DRV8214_RC_STATUS3] << 8) | live[DRV8214_RC_STATUS2];
+            int8_t direction = driveDirection(live[DRV8214_CONFIG4]);
+            if (direction != 0) { motion_direction = direction; }
+            configured = true;
+        } else if ((live[DRV8214_FAULT] & FAULT_NPOR) && memcmp(device, DRV8214_RESET_VALUES + DRV8214_CONFIG0, DRV8214_CONFIG_COUNT) == 0) {
+            // Confirmed power-on reset: only the registers that differ from their reset value are written
+            writeImageChanges(device);
+            last_ripple_count = 0; // Cleared by the reset
+            configured = true;
+        } else {
+            memcpy(shadow, device, DRV8214_CONFIG_COUNT); // Back to the device image, registers init() does not write keep their value
+        }
+    }
 
-    // Store the configuration settings
-    config = cfg;
+    if (!configured) {
+        applyConfiguration(config);
+        writeFields(FIELD_CONFIG0_CLR_FLT::set(true)); // Acknowledge the power-up, NPOR is set again only if the device resets
+    }
+    #if DRV8214_LOG_MODE == DRV8214_LOG_TEXT
+        if (verbose) {printMotorConfig(true);}
+    #endif
 
+    return busStatus(errors); // DRV8214_OK or DRV8214_ERR_BUS
+}
+
+// Configuration sequence of init(), also run without bus access to compute the expected image
+void DRV8214::applyConfiguration(const DRV8214_Config& config) {
     disableHbridge(); // Disable H-bridge to be able to configure the driver
     setControlMode(config.control_mode, config.I2CControlled); // Default to PWM control with I2C enabled
     setRegulationMode(config.regulation_mode); // Default to SPEED regulation
@@ -35,9 +105,246 @@ uint8_t DRV8214::init(const DRV8214_Config& cfg) {
     setKMCScale(config.kmc_scale); // Default to KMC scale factor = 24 x 2^13
     brakeMotor(true); // Default to brake motor
     enableErrorCorrection(false); // Default to disable error correction
-    if (config.verbose) {printMotorConfig(true);}
+}
+
+// Run the init sequence without bus access on top of the shadow image, which holds the expected image afterwards
+void DRV8214::dryRunConfiguration(const DRV8214_Config& config) {
+    int32_t  saved_position = position;
+    uint16_t saved_ripple_count = last_ripple_count;
+    bool     saved_verbose = verbose;
+    verbose = false; // The sequence is logged when it runs for real
+    dry_run = true;
+    applyConfiguration(config);
+    dry_run = false;
+    verbose = saved_verbose;
+    position = saved_position;
+    last_ripple_count = saved_ripple_count;
+}
+
+// Write the registers of the shadow image that differ from base, CONFIG0 last since it enables the outputs.
+// Runs of changed registers share a burst when the unchanged registers between them cost less than a new transfer.
+uint8_t DRV8214::writeImageChanges(const uint8_t* base) {
+    uint16_t errors = bus_errors;
+    uint8_t first = 1;
+    while (first < DRV8214_CONFIG_COUNT) {
+        if (shadow[first] == base[first]) { first++; continue; }
+        uint8_t last = first;
+        for (uint8_t next = first + 1; next < DRV8214_CONFIG_COUNT; next++) {
+            if (shadow[next] == base[next]) { continue; }
+            uint32_t merged = drv8214_bus_transfer_us(false, next - first + 1, DRV8214_I2C_BUS_HZ);
+            uint32_t split = drv8214_bus_transfer_us(false, last - first + 1, DRV8214_I2C_BUS_HZ) + drv8214_bus_transfer_us(false, 1, DRV8214_I2C_BUS_HZ);
+            if (merged > split) { break; }
+            last = next;
+        }
+        regWriteBurst(DRV8214_CONFIG0 + first, shadow + first, last - first + 1);
+        first = last + 1;
+    }
+    regWrite(DRV8214_CONFIG0, shadow[0] | CONFIG0_CLR_FLT); // CLR_FLT acknowledges NPOR
+    return busStatus(errors);
+}
+
+// Direction driven by the I2C bridge control bits of CONFIG4, 0 when braking or coasting
+int8_t DRV8214::driveDirection(uint8_t config4) {
+    bool in1 = config4 & CONFIG4_I2C_EN_IN1;
+    bool in2 = config4 & CONFIG4_I2C_PH_IN2;
+    if (controlMode() == PWM) { return (in1 == in2) ? 0 : (in1 ? 1 : -1); }
+    return in1 ? (in2 ? 1 : -1) : 0;
+}
+
+// CS_GAIN_SEL settings (Table 8-7): full scale of REG_STATUS2 in mA and current mirror gain in uA/A
+static const uint16_t drv_cs_gain_max_ma[8]   = { 4000, 2000, 1000, 500, 250, 125, 250, 125 };
+static const uint16_t drv_cs_gain_aipropri[8] = { 225, 225, 1125, 1125, 5560, 5560, 5560, 5560 };
+
+// INV_R_SCALE settings
+static const uint16_t drv_inv_r_scales[4] = { 2, 64, 1024, 8192 };
+
+uint16_t DRV8214::maxCurrentmA() const {
+    return drv_cs_gain_max_ma[shadowField<FIELD_RC_CTRL0_CS_GAIN_SEL>()];
+}
+
+// --- Register Access ---
+
+// Bus failures are counted and remembered in last_error, the setters compare bus_errors before and after their accesses
+uint8_t DRV8214::busResult(uint8_t i2c_result) {
+    if (i2c_result == DRV8214_I2C_OK) { return DRV8214_OK; }
+    bus_errors++;
+    last_error = DRV8214_ERR_BUS;
+    last_bus_result = i2c_result;
+    return DRV8214_ERR_BUS;
+}
+
+uint8_t DRV8214::busStatus(uint16_t errors_before) {
+    return (bus_errors == errors_before) ? DRV8214_OK : DRV8214_ERR_BUS;
+}
+
+uint8_t DRV8214::regRead(uint8_t reg) {
+    uint8_t value;
+    if (dry_run) { shadowLoad(reg, &value, 1); return value; }
+    busResult(Bus::read(address, reg, &value));
+    return value; // 0 on failure
+}
+
+uint8_t DRV8214::regWrite(uint8_t reg, uint8_t value) {
+    uint8_t status = dry_run ? DRV8214_OK : busResult(Bus::write(address, reg, value));
+    if (status == DRV8214_OK) { shadowStore(reg, &value, 1); }
+    return status;
+}
+
+uint8_t DRV8214::regReadBurst(uint8_t reg, uint8_t* data, uint8_t length) {
+    if (dry_run) { shadowLoad(reg, data, length); return DRV8214_OK; }
+    return busResult(Bus::readBurst(address, reg, data, length));
+}
+
+uint8_t DRV8214::regWriteBurst(uint8_t reg, const uint8_t* data, uint8_t length) {
+    uint8_t status = dry_run ? DRV8214_OK : busResult(Bus::writeBurst(address, reg, data, length));
+    if (status == DRV8214_OK) { shadowStore(reg, data, length); }
+    return status;
+}
+
+uint8_t DRV8214::regModifyBits(uint8_t reg, uint8_t mask, uint8_t new_value) {
+    uint8_t value;
+    if (regReadBurst(reg, &value, 1) != DRV8214_OK) { return DRV8214_ERR_BUS; } // Writing back would clobber the other bits
+    value = (value & ~mask) | (new_value & mask); // Apply new value only to masked bits
+    return regWrite(reg, value);
+}
+
+void DRV8214::shadowStore(uint8_t reg, const uint8_t* data, uint8_t length) {
+    for (uint8_t i = 0; i < length; i++, reg++) {
+        if (reg < DRV8214_CONFIG0 || reg > DRV8214_RC_CTRL8) { continue; }
+        uint8_t value = data[i];
+        if (reg == DRV8214_CONFIG0) { value &= ~(CONFIG0_CLR_CNT | CONFIG0_CLR_FLT); } // Commands, not configuration
+        shadow[reg - DRV8214_CONFIG0] = value;
+    }
+}
+
+// Dry run reads: configuration registers from the image, status registers as 0
+void DRV8214::shadowLoad(uint8_t reg, uint8_t* data, uint8_t length) {
+    for (uint8_t i = 0; i < length; i++, reg++) {
+        data[i] = (reg >= DRV8214_CONFIG0 && reg <= DRV8214_RC_CTRL8) ? shadow[reg - DRV8214_CONFIG0] : 0;
+    }
+}
+
+uint8_t DRV8214::getLastError() {
+    uint8_t error = last_error;
+    last_error = DRV8214_OK;
+    return error;
+}
+
+uint8_t DRV8214::getLastBusResult() {
+    return last_bus_result;
+}
+
+// --- Recovery Functions ---
+
+uint8_t DRV8214::restoreConfiguration(bool clear_faults) {
+    DRV8214_API_SCOPE();
+    if (!shadow_valid) { return DRV8214_ERR_INVALID; } // Nothing to restore before init()
+    // CONFIG0 holds EN_OUT, it is written once the rest of the image is in place
+    uint8_t status = regWriteBurst(DRV8214_CONFIG1, shadow + 1, DRV8214_CONFIG_COUNT - 1);
+    if (status == DRV8214_OK) { status = regWrite(DRV8214_CONFIG0, shadow[0] | (clear_faults ? CONFIG0_CLR_FLT : 0)); }
+    return status;
+}
+
+// A brown-out reverts every register to its reset value and restarts the ripple counter from 0.
+// The image is replayed at once, only the ripples counted between the previous poll and the reset are lost.
+uint8_t DRV8214::handlePowerOnReset() {
+    last_ripple_count = 0;
+    uint8_t status = restoreConfiguration(true); // CLR_FLT acknowledges NPOR, a failed restore is retried on the next poll
+    if (status == DRV8214_OK) { npor_events++; }
+    DRV8214_LOG(POWER_ON_RESET, npor_events, status);
+    return status;
+}
+
+uint16_t DRV8214::getPowerOnResetCount() {
+    return npor_events;
+}
+
+// Scrubber transfers are reported apart in the bus counters, with their bus time
+static uint32_t drv_scrub_account(bool read, uint8_t length) {
+    uint32_t us = drv8214_bus_transfer_us(read, length, DRV8214_I2C_BUS_HZ);
+    drv8214_i2c_stats.scrub_transfers++;
+    drv8214_i2c_stats.scrub_us += us;
+    return us;
+}
+
+// Each call reads one burst of up to DRV8214_SCRUB_BURST registers from where the previous call stopped, shortened so
+// the read and one repair fit in budget_us. Registers that differ from the shadow image are rewritten while the
+// budget allows, the next call starts at the first one left unrepaired.
+uint8_t DRV8214::scrubConfiguration(uint32_t budget_us) {
+    DRV8214_API_SCOPE();
+    if (!shadow_valid) { return DRV8214_ERR_INVALID; }
+    uint8_t length = DRV8214_CONFIG_COUNT - scrub_cursor; // Bursts stop at RC_CTRL8, the next one restarts at CONFIG0
+    if (length > DRV8214_SCRUB_BURST) { length = DRV8214_SCRUB_BURST; }
+    uint32_t repair_us = drv8214_bus_transfer_us(false, 1, DRV8214_I2C_BUS_HZ);
+    while (length > 0 && drv8214_bus_transfer_us(true, length, DRV8214_I2C_BUS_HZ) + repair_us > budget_us) { length--; }
+    if (length == 0) { return DRV8214_OK; } // Budget too small for a single register
+
+    uint16_t errors = bus_errors;
+    uint8_t data[DRV8214_SCRUB_BURST];
+    uint32_t spent = drv_scrub_account(true, length);
+    if (regReadBurst(DRV8214_CONFIG0 + scrub_cursor, data, length) != DRV8214_OK) { return busStatus(errors); } // Same registers next call
+    uint8_t checked = 0;
+    for (; checked < length; checked++) {
+        uint8_t expected = shadow[scrub_cursor + checked];
+        if (data[checked] == expected) { continue; }
+        if (spent + repair_us > budget_us) { break; } // Read again and repaired by the next call
+        uint8_t reg = DRV8214_CONFIG0 + scrub_cursor + checked;
+        logDriftedFields(reg, data[checked], expected);
+        spent += drv_scrub_account(false, 1);
+        if (regWrite(reg, expected) == DRV8214_OK) { scrub_repairs++; }
+    }
+    scrub_cursor = (scrub_cursor + checked) % DRV8214_CONFIG_COUNT;
+    return busStatus(errors);
+}
+
+// One SCRUB_FIELD event per drifted field, identified by its index in DRV8214_FIELD_TABLE for the log decoder.
+// The bits no field covers are reported with the index DRV8214_FIELD_TABLE_SIZE.
+void DRV8214::logDriftedFields(uint8_t reg, uint8_t actual, uint8_t expected) {
+    #if DRV8214_LOG_MODE != DRV8214_LOG_NONE
+        uint8_t changed = actual ^ expected;
+        uint8_t unnamed = 0xFF;
+        for (uint8_t index = 0; index < DRV8214_FIELD_TABLE_SIZE; index++) {
+            const DRV8214_FieldDesc& field = DRV8214_FIELD_TABLE[index];
+            if (field.reg != reg) { continue; }
+            unnamed &= ~field.mask;
+            if (changed & field.mask) { DRV8214_LOG(SCRUB_FIELD, index, reg, actual & field.mask, expected & field.mask); }
+        }
+        if (changed & unnamed) { DRV8214_LOG(SCRUB_FIELD, (uint8_t)DRV8214_FIELD_TABLE_SIZE, reg, actual & unnamed, expected & unnamed); }
+    #else
+        (void)reg; (void)actual; (void)expected;
+    #endif
+}
+
+uint16_t DRV8214::getScrubRepairCount() {
+    return scrub_repairs;
+}
+
+uint8_t DRV8214::getShadowRegister(uint8_t reg) {
+    if (reg < DRV8214_CONFIG0 || reg > DRV8214_RC_CTRL8) { return 0; }
+    return shadow[reg - DRV8214_CONFIG0];
+}
 
-    return DRV8214_OK; // Return success code
+uint8_t DRV8214::readRegisters(uint8_t* image) {
+    DRV8214_API_SCOPE();
+    return regReadBurst(DRV8214_FAULT, image, DRV8214_REG_COUNT);
+}
+
+void DRV8214::getExpectedImage(uint8_t* image) {
+    for (uint8_t reg = 0; reg < DRV8214_REG_COUNT; reg++) {
+        image[reg] = (reg >= DRV8214_CONFIG0 && reg <= DRV8214_RC_CTRL8) ? shadow[reg - DRV8214_CONFIG0] : DRV8214_RESET_VALUES[reg];
+    }
+}
+
+uint8_t DRV8214::serviceBus(DRV8214* const* drivers, uint8_t count) {
+    DRV8214_TIMELINE_SCOPE(span, "serviceBus", DRV8214_TIMELINE_BUS_TRACK, 0); // Static, on the bus track
+    if (!drv8214_i2c_recovery_pending) { return DRV8214_OK; }
+    if (drv8214_i2c_recover_bus() != DRV8214_I2C_OK) { return DRV8214_ERR_BUS; } // SDA still held low
+    // A transfer cut by the fault may have left any register half written, or a driver may have reset
+    uint8_t status = DRV8214_OK;
+    for (uint8_t i = 0; i < count; i++) {
+        if (drivers[i]->restoreConfiguration() == DRV8214_ERR_BUS) { status = DRV8214_ERR_BUS; }
+    }
+    return status;
 }
 
 // --- Helper Functions ---
@@ -54,121 +361,147 @@ uint8_t DRV8214::getSenseResistor() {
     return Ripropri;
 }
 
-uint8_t DRV8214::getRipplesPerRevolution() {
+uint16_t DRV8214::getRipplesPerRevolution() {
     return ripples_per_revolution;
 }
 
+float DRV8214::getRipplesPerShaftRevolution() {
+    return ripples_per_shaft_revolution;
+}
+
+void DRV8214::setRipplesPerShaftRevolution(float ripples) {
+    ripples_per_shaft_revolution = ripples;
+}
+
+uint8_t DRV8214::getMotorInternalResistance() {
+    return motor_internal_resistance;
+}
+
+uint8_t DRV8214::getMotorReductionRatio() {
+    return motor_reduction_ratio;
+}
+
 uint8_t DRV8214::getFaultStatus() {
-    return drv8214_i2c_read_register(address, DRV8214_FAULT);
+    DRV8214_API_SCOPE();
+    return regRead(DRV8214_FAULT);
 }
 
+// Speed conversions use the fractional ripples per shaft revolution, the rotor value is derived from the reduction ratio
 uint32_t DRV8214::getMotorSpeedRPM() {
-    return ((drv8214_i2c_read_register(address, DRV8214_RC_STATUS1) * config.w_scale * 60) / (2 * M_PI * ripples_per_revolution));
+    DRV8214_API_SCOPE();
+    DRV8214_UnitScales scales;
+    getUnitScales(scales);
+    return (uint32_t)drv8214_convert_speed(regRead(DRV8214_RC_STATUS1), scales.rpm_per_lsb);
 }
 
 uint16_t DRV8214::getMotorSpeedRAD() {
-    return ((drv8214_i2c_read_register(address, DRV8214_RC_STATUS1) * config.w_scale) / ripples_per_revolution);
+    DRV8214_API_SCOPE();
+    float ripple_speed = regRead(DRV8214_RC_STATUS1) * wScale(); // rad/s
+    return (uint16_t)((ripple_speed * motor_reduction_ratio) / ripples_per_shaft_revolution);
 }
 
 uint16_t DRV8214::getMotorSpeedShaftRPM() {
-    return (getMotorSpeedRPM() / motor_reduction_ratio);
+    DRV8214_API_SCOPE();
+    float ripple_speed = regRead(DRV8214_RC_STATUS1) * wScale(); // rad/s
+    return (uint16_t)((ripple_speed * 60.0f) / (2.0f * (float)M_PI * ripples_per_shaft_revolution));
 }
 
 uint16_t DRV8214::getMotorSpeedShaftRAD() {
-    return (getMotorSpeedRAD() / motor_reduction_ratio);
+    DRV8214_API_SCOPE();
+    float ripple_speed = regRead(DRV8214_RC_STATUS1) * wScale(); // rad/s
+    return (uint16_t)(ripple_speed / ripples_per_shaft_revolution);
 }
 
 uint8_t DRV8214::getMotorSpeedRegister() {
-    return drv8214_i2c_read_register(address, DRV8214_RC_STATUS1);
+    DRV8214_API_SCOPE();
+    return regRead(DRV8214_RC_STATUS1);
 }
 
 uint16_t DRV8214::getRippleCount() {
-    return (drv8214_i2c_read_register(address, DRV8214_RC_STATUS3) << 8) | drv8214_i2c_read_register(address, DRV8214_RC_STATUS2);
+    DRV8214_API_SCOPE();
+    return (regRead(DRV8214_RC_STATUS3) << 8) | regRead(DRV8214_RC_STATUS2);
 }
 
 float DRV8214::getMotorVoltage() {
-    if (config.voltage_range) {
-        float voltage = (drv8214_i2c_read_register(address, DRV8214_REG_STATUS1) / 255.0f) * 3.92f;
-        return voltage;
-    } else {
-        if (config.ovp_enabled) {
-            // If OVP is enabled, the maximum voltage is 11 V
-            if (drv8214_i2c_read_register(address, DRV8214_REG_STATUS1) > 0xB0) {
-                return 11.0f;
-            } else {     // 00h corresponds to 0 V and B0h corresponds to 11 V.
-                float voltage = (drv8214_i2c_read_register(address, DRV8214_REG_STATUS1) / 176.0f) * 11.0f;
-                return voltage;
-            }
-        } else {
-            float voltage = (drv8214_i2c_read_register(address, DRV8214_REG_STATUS1) / 255.0f) * 15.7f;
-            return voltage;
-        }
-    }
+    DRV8214_API_SCOPE();
+    return convertMotorVoltage(regRead(DRV8214_REG_STATUS1));
 }
 
 uint8_t DRV8214::getMotorVoltageRegister() {
-    return drv8214_i2c_read_register(address, DRV8214_REG_STATUS1);
+    DRV8214_API_SCOPE();
+    return regRead(DRV8214_REG_STATUS1);
 }
 
 float DRV8214::getMotorCurrent() {
-    // 00h corresponds to 0 A and C0h corresponds to the maximum value set by the CS_GAIN_SEL bit
-    float current = (drv8214_i2c_read_register(address, DRV8214_REG_STATUS2) / 192.0f) * config.MaxCurrent;
-    return current;
+    DRV8214_API_SCOPE();
+    return convertMotorCurrent(regRead(DRV8214_REG_STATUS2));
 }
 
 uint8_t DRV8214::getMotorCurrentRegister() {
-    return drv8214_i2c_read_register(address, DRV8214_REG_STATUS2);
+    DRV8214_API_SCOPE();
+    return regRead(DRV8214_REG_STATUS2);
 }
 
 uint8_t DRV8214::getDutyCycle() {
-    uint8_t dutyCycle = drv8214_i2c_read_register(address, DRV8214_REG_STATUS3) & REG_STATUS3_IN_DUTY;
-    return (dutyCycle * 100) / 63; // Convert 6-bit value to percentage
+    DRV8214_API_SCOPE();
+    return convertDutyCycle(regRead(DRV8214_REG_STATUS3));
 }
 
 uint8_t DRV8214::getCONFIG0() {
-    return drv8214_i2c_read_register(address, DRV8214_CONFIG0);
+    DRV8214_API_SCOPE();
+    return regRead(DRV8214_CONFIG0);
 }
 
 uint16_t DRV8214::getInrushDuration() {
-    return (drv8214_i2c_read_register(address, DRV8214_CONFIG1) << 8) | drv8214_i2c_read_register(address, DRV8214_CONFIG2);
+    DRV8214_API_SCOPE();
+    return (regRead(DRV8214_CONFIG1) << 8) | regRead(DRV8214_CONFIG2);
 }
 
 uint8_t DRV8214::getCONFIG3() {
-    return drv8214_i2c_read_register(address, DRV8214_CONFIG3);
+    DRV8214_API_SCOPE();
+    return regRead(DRV8214_CONFIG3);
 }
 
 uint8_t DRV8214::getCONFIG4() {
-    return drv8214_i2c_read_register(address, DRV8214_CONFIG4);
+    DRV8214_API_SCOPE();
+    return regRead(DRV8214_CONFIG4);
 }
 
 uint8_t DRV8214::getREG_CTRL0() {
-    return drv8214_i2c_read_register(address, DRV8214_REG_CTRL0);
+    DRV8214_API_SCOPE();
+    return regRead(DRV8214_REG_CTRL0);
 }
 
 uint8_t DRV8214::getREG_CTRL1() {
-    return drv8214_i2c_read_register(address, DRV8214_REG_CTRL1);
+    DRV8214_API_SCOPE();
+    return regRead(DRV8214_REG_CTRL1);
 }
 
 uint8_t DRV8214::getREG_CTRL2() {
-    return drv8214_i2c_read_register(address, DRV8214_REG_CTRL2);
+    DRV8214_API_SCOPE();
+    return regRead(DRV8214_REG_CTRL2);
 }
 
 uint8_t DRV8214::getRC_CTRL0() {
-    return drv8214_i2c_read_register(address, DRV8214_RC_CTRL0);
+    DRV8214_API_SCOPE();
+    return regRead(DRV8214_RC_CTRL0);
 }
 
 uint8_t DRV8214::getRC_CTRL1() {
-    return drv8214_i2c_read_register(address, DRV8214_RC_CTRL1);
+    DRV8214_API_SCOPE();
+    return regRead(DRV8214_RC_CTRL1);
 }
 
 uint8_t DRV8214::getRC_CTRL2() {
-    return drv8214_i2c_read_register(address, DRV8214_RC_CTRL2);
+    DRV8214_API_SCOPE();
+    return regRead(DRV8214_RC_CTRL2);
 }
 
 uint16_t DRV8214::getRippleThreshold()
 {
-    uint8_t ctrl2 = drv8214_i2c_read_register(address, DRV8214_RC_CTRL2);
-    uint8_t ctrl1 = drv8214_i2c_read_register(address, DRV8214_RC_CTRL1);
+    DRV8214_API_SCOPE();
+    uint8_t ctrl2 = regRead(DRV8214_RC_CTRL2);
+    uint8_t ctrl1 = regRead(DRV8214_RC_CTRL1);
     // top two bits are bits 1..0 in ctrl2
     uint16_t thr_high = (ctrl2 & 0x03) << 8; // shift them to bits 9..8
     uint16_t thr_low  = ctrl1;               // bits 7..0
@@ -176,185 +509,247 @@ uint16_t DRV8214::getRippleThreshold()
 }
 
 uint16_t DRV8214::getRippleThresholdScaled() {
-    getRippleThresholdScale();
-    if (config.ripple_threshold_scale  == 0) { return getRippleThreshold() * 2;  }
-    if (config.ripple_threshold_scale  == 1) { return getRippleThreshold() * 8;  }
-    if (config.ripple_threshold_scale  == 2) { return getRippleThreshold() * 16; }
-    if (config.ripple_threshold_scale  == 3) { return getRippleThreshold() * 64; }
-    return getRippleThreshold() * config.ripple_threshold_scale;
+    DRV8214_API_SCOPE();
+    static const uint8_t multipliers[4] = {2, 8, 16, 64}; // RC_THR_SCALE
+    return getRippleThreshold() * multipliers[getRippleThresholdScale()];
 }
 
 uint16_t DRV8214::getRippleThresholdScale() {
-    config.ripple_threshold_scale = (drv8214_i2c_read_register(address, DRV8214_RC_CTRL2) & RC_CTRL2_RC_THR_SCALE) >> 2;
-    return config.ripple_threshold_scale;
+    DRV8214_API_SCOPE();
+    return FIELD_RC_CTRL2_RC_THR_SCALE::decode(regRead(DRV8214_RC_CTRL2));
 }
 
 uint8_t DRV8214::getKMC() {
-    return drv8214_i2c_read_register(address, DRV8214_RC_CTRL4);
+    DRV8214_API_SCOPE();
+    return regRead(DRV8214_RC_CTRL4);
 }
 
 uint8_t DRV8214::getKMCScale() {
-    return (drv8214_i2c_read_register(address, DRV8214_RC_CTRL2) >> 4) & 0x03;
+    DRV8214_API_SCOPE();
+    return (regRead(DRV8214_RC_CTRL2) >> 4) & 0x03;
 }
 
 uint8_t DRV8214::getFilterDamping() {
-    return (drv8214_i2c_read_register(address, DRV8214_RC_CTRL5) >> 4) & 0x0F;
+    DRV8214_API_SCOPE();
+    return (regRead(DRV8214_RC_CTRL5) >> 4) & 0x0F;
 }
 
 uint8_t DRV8214::getRC_CTRL6() {
-    return drv8214_i2c_read_register(address, DRV8214_RC_CTRL6);
+    DRV8214_API_SCOPE();
+    return regRead(DRV8214_RC_CTRL6);
 }
 
 uint8_t DRV8214::getRC_CTRL7() {
-    return drv8214_i2c_read_register(address, DRV8214_RC_CTRL7);
+    DRV8214_API_SCOPE();
+    return regRead(DRV8214_RC_CTRL7);
 }
 
 uint8_t DRV8214::getRC_CTRL8() {
-    return drv8214_i2c_read_register(address, DRV8214_RC_CTRL8);
+    DRV8214_API_SCOPE();
+    return regRead(DRV8214_RC_CTRL8);
+}
+
+uint8_t DRV8214::readStatus(DRV8214_Status& status) {
+    DRV8214_API_SCOPE();
+    uint8_t raw[7];
+    uint8_t result = regReadBurst(DRV8214_FAULT, raw, sizeof(raw)); // FAULT to REG_STATUS3 in one transaction
+    decodeStatus(raw, status);
+    if (result == DRV8214_OK && (status.fault & FAULT_NPOR) && shadow_valid) { result = handlePowerOnReset(); }
+    return result;
+}
+
+void DRV8214::decodeStatus(const uint8_t* raw, DRV8214_Status& status) {
+    status.fault        = raw[DRV8214_FAULT];
+    status.speed        = raw[DRV8214_RC_STATUS1];
+    status.ripple_count = (raw[DRV8214_RC_STATUS3] << 8) | raw[DRV8214_RC_STATUS2];
+    status.voltage      = raw[DRV8214_REG_STATUS1];
+    status.current      = raw[DRV8214_REG_STATUS2];
+    status.duty         = raw[DRV8214_REG_STATUS3];
+}
+
+float DRV8214::convertMotorVoltage(uint8_t voltage_register) {
+    DRV8214_UnitScales scales;
+    getUnitScales(scales);
+    return drv8214_convert_voltage(voltage_register, scales.volts_per_lsb, scales.volts_max);
+}
+
+float DRV8214::convertMotorCurrent(uint8_t current_register) {
+    DRV8214_UnitScales scales;
+    getUnitScales(scales);
+    return drv8214_convert_current(current_register, scales.amps_per_lsb);
+}
+
+uint8_t DRV8214::convertDutyCycle(uint8_t duty_register) {
+    return drv8214_convert_duty(duty_register);
+}
+
+void DRV8214::getUnitScales(DRV8214_UnitScales& scales) {
+    if (shadowField<FIELD_CONFIG0_VM_GAIN_SEL>()) {
+        scales.volts_per_lsb = 3.92f / 255.0f; // FFh corresponds to 3.92 V
+        scales.volts_max = 3.92f;
+    } else if (shadowField<FIELD_CONFIG0_EN_OVP>()) {
+        scales.volts_per_lsb = 11.0f / 176.0f; // B0h corresponds to 11 V, the maximum with OVP
+        scales.volts_max = 11.0f;
+    } else {
+        scales.volts_per_lsb = 15.7f / 255.0f; // FFh corresponds to 15.7 V
+        scales.volts_max = 15.7f;
+    }
+    // C0h corresponds to the maximum value set by the CS_GAIN_SEL bits
+    scales.amps_per_lsb = (maxCurrentmA() / 1000.0f) / 192.0f;
+    // RC_STATUS1 counts W_SCALE rad/s of ripple frequency per step
+    scales.rpm_per_lsb = (wScale() * 60.0f * motor_reduction_ratio) / (2.0f * (float)M_PI * ripples_per_shaft_revolution);
 }
 
 // --- Control Functions ---
-void DRV8214::enableHbridge() {
-    drv8214_i2c_modify_register(address, DRV8214_CONFIG0, CONFIG0_EN_OUT, true);
+uint8_t DRV8214::enableHbridge() {
+    DRV8214_API_SCOPE();
+    return writeFields(FIELD_CONFIG0_EN_OUT::set(true));
 }
 
-void DRV8214::disableHbridge() {
-    drv8214_i2c_modify_register(address, DRV8214_CONFIG0, CONFIG0_EN_OUT, false);
+uint8_t DRV8214::disableHbridge() {
+    DRV8214_API_SCOPE();
+    return writeFields(FIELD_CONFIG0_EN_OUT::set(false));
 }
 
-void DRV8214::setStallDetection(bool stall_en) {
-    config.stall_enabled = stall_en;
-    drv8214_i2c_modify_register(address, DRV8214_CONFIG3, CONFIG0_EN_STALL, stall_en);
+uint8_t DRV8214::setStallDetection(bool stall_en) {
+    DRV8214_API_SCOPE();
+    return writeFields(FIELD_CONFIG0_EN_STALL::set(stall_en));
 }
 
-void DRV8214::setVoltageRange(bool range) {
-    config.voltage_range = range;
-    drv8214_i2c_modify_register(address, DRV8214_CONFIG0, CONFIG0_VM_GAIN_SEL, range);
+uint8_t DRV8214::setVoltageRange(bool range) {
+    DRV8214_API_SCOPE();
+    return writeFields(FIELD_CONFIG0_VM_GAIN_SEL::set(range));
 }
 
-void DRV8214::setOvervoltageProtection(bool OVP) {
-    config.ovp_enabled = OVP;
-    drv8214_i2c_modify_register(address, DRV8214_CONFIG0, CONFIG0_EN_OVP, true);
+uint8_t DRV8214::setOvervoltageProtection(bool OVP) {
+    DRV8214_API_SCOPE();
+    return writeFields(FIELD_CONFIG0_EN_OVP::set(OVP));
 }
 
-void DRV8214::resetRippleCounter() {
-    drv8214_i2c_modify_register(address, DRV8214_CONFIG0, CONFIG0_CLR_CNT, true);
+uint8_t DRV8214::resetRippleCounter() {
+    DRV8214_API_SCOPE();
+    updatePosition(); // Account the ripples counted so far before they are cleared
+    uint8_t result = writeFields(FIELD_CONFIG0_CLR_CNT::set(true));
+    if (result == DRV8214_OK) { last_ripple_count = 0; } // Otherwise the counter keeps running from the accounted value
+    return result;
 }
 
-void DRV8214::resetFaultFlags() {
+uint8_t DRV8214::resetFaultFlags() {
+    DRV8214_API_SCOPE();
+    uint16_t errors = bus_errors;
     disableHbridge();
-    drv8214_i2c_modify_register(address, DRV8214_CONFIG0, CONFIG0_CLR_FLT, true);
+    writeFields(FIELD_CONFIG0_CLR_FLT::set(true));
     enableHbridge();
+    return busStatus(errors);
 }
 
-void DRV8214::enableDutyCycleControl() {
-    drv8214_i2c_modify_register(address, DRV8214_CONFIG0, CONFIG0_DUTY_CTRL, true);
+uint8_t DRV8214::enableDutyCycleControl() {
+    DRV8214_API_SCOPE();
+    return writeFields(FIELD_CONFIG0_DUTY_CTRL::set(true));
 }
 
-void DRV8214::disableDutyCycleControl() {
-    drv8214_i2c_modify_register(address, DRV8214_CONFIG0, CONFIG0_DUTY_CTRL, false);
+uint8_t DRV8214::disableDutyCycleControl() {
+    DRV8214_API_SCOPE();
+    return writeFields(FIELD_CONFIG0_DUTY_CTRL::set(false));
 }
 
-void DRV8214::setInrushDuration(uint16_t threshold) {
-    drv8214_i2c_write_register(address, DRV8214_CONFIG1, (threshold >> 8) & 0xFF);
-    drv8214_i2c_write_register(address, DRV8214_CONFIG2, threshold & 0xFF);
+uint8_t DRV8214::setInrushDuration(uint16_t threshold) {
+    DRV8214_API_SCOPE();
+    uint16_t errors = bus_errors;
+    regWrite(DRV8214_CONFIG1, (threshold >> 8) & 0xFF);
+    regWrite(DRV8214_CONFIG2, threshold & 0xFF);
+    return busStatus(errors);
 }
 
-void DRV8214::setCurrentRegMode(uint8_t mode) {
-
-    if (mode > 3) { mode = 3; } // Cap mode to 3
-    switch (mode){
-    case 0: // 0b00
-        mode = 0x00; // No current regulation at anytime
-        config.current_reg_mode = 0;
-        break;
-    case 1: // 0b01
-        mode = 0x40; // Current regulation at all time if stall detection is desabled
-        config.current_reg_mode = 1; // Current regulation during tinrush only if stall detection is enabled
-        break;       
-    case 2: // 0b10
-        mode = 0x80; // Current regulation at all time
-        config.current_reg_mode = 2;
-        break;
-    case 3: // 0b11
-        mode = 0xC0; // Current regulation at all time
-        config.current_reg_mode = 3;
-        break;
-    default:
-        break;
-    }
-    drv8214_i2c_modify_register_bits(address, DRV8214_CONFIG3, CONFIG3_IMODE, mode);
+uint8_t DRV8214::setCurrentRegMode(uint8_t mode) {
+    DRV8214_API_SCOPE();
+    // 0b00: No current regulation at any time
+    // 0b01: Current regulation during tinrush only if stall detection is enabled, at all times if it is disabled
+    // 0b10, 0b11: Current regulation at all times
+    if (mode > FIELD_CONFIG3_IMODE::max_value) { mode = FIELD_CONFIG3_IMODE::max_value; } // Cap mode to 3
+    return writeFields(FIELD_CONFIG3_IMODE::set(mode));
 }
 
-void DRV8214::setStallBehavior(bool behavior) {
+uint8_t DRV8214::setStallBehavior(bool behavior) {
+    DRV8214_API_SCOPE();
     // The SMODE bit programs the device's response to a stall condition. 
     // When SMODE = 0b, the STALL bit becomes 1b, the outputs are disabled
     // When SMODE = 1b, the STALL bit becomes 1b, but the outputs continue to drive current into the motor
-    config.stall_behavior = behavior;
-    drv8214_i2c_modify_register(address, DRV8214_CONFIG3, CONFIG3_SMODE, behavior);
+    return writeFields(FIELD_CONFIG3_SMODE::set(behavior));
 }
 
-void DRV8214::setInternalVoltageReference(float reference_voltage) {
+uint8_t DRV8214::setInternalVoltageReference(float reference_voltage) {
+    DRV8214_API_SCOPE();
     // VVREF must be lower than VVM by at least 1.25 V. The maximum recommended value of VVREF is 3.3 V. 
     // If INT_VREF bit is set to 1b, VVREF is internally selected with a fixed value of 500 mV.
     if (reference_voltage == 0) { 
-        config.Vref = 0.5f; // Default
-        drv8214_i2c_modify_register(address, DRV8214_CONFIG3, CONFIG3_INT_VREF, true);
+        vref_mv = 500; // Default
+        return writeFields(FIELD_CONFIG3_INT_VREF::set(true));
     } else { 
-        config.Vref = reference_voltage;
-        drv8214_i2c_modify_register(address, DRV8214_CONFIG3, CONFIG3_INT_VREF, false);
+        vref_mv = (uint16_t)(reference_voltage * 1000.0f + 0.5f);
+        return writeFields(FIELD_CONFIG3_INT_VREF::set(false));
     }
 }
 
-void DRV8214::configureConfig3(uint8_t config3) {
-    drv8214_i2c_write_register(address, DRV8214_CONFIG3, config3);
+uint8_t DRV8214::configureConfig3(uint8_t config3) {
+    DRV8214_API_SCOPE();
+    return regWrite(DRV8214_CONFIG3, config3);
 }
 
-void DRV8214::setI2CControl(bool I2CControl) {
-    config.I2CControlled = I2CControl;
-    drv8214_i2c_modify_register(address, DRV8214_CONFIG4, CONFIG4_I2C_BC, I2CControl);
+uint8_t DRV8214::setI2CControl(bool I2CControl) {
+    DRV8214_API_SCOPE();
+    return writeFields(FIELD_CONFIG4_I2C_BC::set(I2CControl));
 }
 
-void DRV8214::enablePWMControl() {
-    drv8214_i2c_modify_register(address, DRV8214_CONFIG4, CONFIG4_PMODE, true);
+uint8_t DRV8214::enablePWMControl() {
+    DRV8214_API_SCOPE();
+    return writeFields(FIELD_CONFIG4_PMODE::set(true));
 }
 
-void DRV8214::enablePHENControl() {
-    drv8214_i2c_modify_register(address, DRV8214_CONFIG4, CONFIG4_PMODE, false);
+uint8_t DRV8214::enablePHENControl() {
+    DRV8214_API_SCOPE();
+    return writeFields(FIELD_CONFIG4_PMODE::set(false));
 }
 
-void DRV8214::enableStallInterrupt() {
-    drv8214_i2c_modify_register(address, DRV8214_CONFIG4, CONFIG4_STALL_REP, true);
+uint8_t DRV8214::enableStallInterrupt() {
+    DRV8214_API_SCOPE();
+    return writeFields(FIELD_CONFIG4_STALL_REP::set(true));
 }
 
-void DRV8214::disableStallInterrupt() {
-    drv8214_i2c_modify_register(address, DRV8214_CONFIG4, CONFIG4_STALL_REP, false);
+uint8_t DRV8214::disableStallInterrupt() {
+    DRV8214_API_SCOPE();
+    return writeFields(FIELD_CONFIG4_STALL_REP::set(false));
 }
 
-void DRV8214::enableCountThresholdInterrupt() {
-    drv8214_i2c_modify_register_bits(address, DRV8214_CONFIG4, CONFIG4_RC_REP, 0b10000000);
+uint8_t DRV8214::enableCountThresholdInterrupt() {
+    DRV8214_API_SCOPE();
+    return writeFields(FIELD_CONFIG4_RC_REP::set(0b10));
 }
 
-void DRV8214::disableCountThresholdInterrupt() {
-    drv8214_i2c_modify_register(address, DRV8214_CONFIG4, CONFIG4_RC_REP, false);
+uint8_t DRV8214::disableCountThresholdInterrupt() {
+    DRV8214_API_SCOPE();
+    return writeFields(FIELD_CONFIG4_RC_REP::set(false));
 }
 
-void DRV8214::setBridgeBehaviorThresholdReached(bool stops) {
+uint8_t DRV8214::setBridgeBehaviorThresholdReached(bool stops) {
+    DRV8214_API_SCOPE();
     // stops = 0b: H-bridge stays enabled when RC_CNT exceeds threshold
     // stops = 1b: H-bridge is disabled (High-Z) when RC_CNT exceeds threshold
-    config.bridge_behavior_thr_reached = stops; 
-    drv8214_i2c_modify_register(address, DRV8214_RC_CTRL0, RC_CTRL0_RC_HIZ, stops);
+    return writeFields(FIELD_RC_CTRL0_RC_HIZ::set(stops));
 }
 
-void DRV8214::setSoftStartStop(bool enable) {
-    drv8214_i2c_modify_register(address, DRV8214_REG_CTRL0, REG_CTRL0_EN_SS, enable);
+uint8_t DRV8214::setSoftStartStop(bool enable) {
+    DRV8214_API_SCOPE();
+    return writeFields(FIELD_REG_CTRL0_EN_SS::set(enable));
 }
 
-void DRV8214::configureControl0(uint8_t control0) {
-    drv8214_i2c_write_register(address, DRV8214_REG_CTRL0, control0);
+uint8_t DRV8214::configureControl0(uint8_t control0) {
+    DRV8214_API_SCOPE();
+    return regWrite(DRV8214_REG_CTRL0, control0);
 }
 
-void DRV8214::setRegulationAndStallCurrent(float requested_current) {
+uint8_t DRV8214::setRegulationAndStallCurrent(float requested_current) {
+    DRV8214_API_SCOPE();
     // According to Table 8-7 "CS_GAIN_SEL Settings":
     //   000b =>  225 μA/A, max current 4 A
     //   001b =>  225 μA/A, max current 2 A
@@ -368,54 +763,38 @@ void DRV8214::setRegulationAndStallCurrent(float requested_current) {
     // Clamp very low currents (<0.125 A) to the lowest recommended setting:
     if (requested_current < 0.125f) {
         cs_gain_sel = 0b111; // 5560 μA/A, max current 0.125 A
-        config.Aipropri = 5560e-6; // Convert μA/A to A/A
-        config.MaxCurrent = 0.125f;
     }
     else if (requested_current < 0.25f) {
         cs_gain_sel = 0b110; // 5560 μA/A, max current 0.25 A
-        config.Aipropri = 5560e-6;
-        config.MaxCurrent = 0.25f;
     }
     else if (requested_current < 0.5f) {
         cs_gain_sel = 0b011; // 1125 μA/A, max current 0.5 A
-        config.Aipropri = 1125e-6;
-        config.MaxCurrent = 0.5f;
     }
     else if (requested_current < 1.0f) {
         cs_gain_sel = 0b010; // 1125 μA/A, max current 1 A
-        config.Aipropri = 1125e-6;
-        config.MaxCurrent = 1.0f;
     }
     else if (requested_current < 2.0f) {
         cs_gain_sel = 0b001; // 225 μA/A, max current 2 A
-        config.Aipropri = 225e-6;
-        config.MaxCurrent = 2.0f;
     }
     else {
         // For >= 2.0 A, recommended setting is 000b (max current 4 A).
         // Also clamp above 4 A to the same setting (since 4 A is the top of the recommended range).
         cs_gain_sel = 0b000; // 225 μA/A, max current 4 A
-        config.Aipropri = 225e-6;
-        config.MaxCurrent = 4.0f;
     }
 
-    drv8214_i2c_modify_register_bits(address, DRV8214_RC_CTRL0, RC_CTRL0_CS_GAIN_SEL, cs_gain_sel);
-
-    // Update Itrip calculation with the new scale
-    config.Itrip = config.Vref / (Ripropri * config.Aipropri);
+    uint8_t result = writeFields(FIELD_RC_CTRL0_CS_GAIN_SEL::set(cs_gain_sel));
 
-    if (config.verbose) {
-        char buffer[256];
-        snprintf(buffer, sizeof(buffer), "Requested Itrip = %f A => Chosen CS_GAIN_SEL: 0b%d => Aipropri = %f uA/A => Actual Itrip = %f A\n", requested_current, cs_gain_sel, config.Aipropri, config.Itrip);
-        drvPrint(buffer);
-    }
+    // Trip current with the new scale: Itrip = VREF / (RIPROPI * AIPROPI)
+    DRV8214_LOG(CURRENT_GAIN, requested_current, cs_gain_sel, (float)drv_cs_gain_aipropri[cs_gain_sel], (vref_mv * 1000.0f) / ((float)Ripropri * drv_cs_gain_aipropri[cs_gain_sel]));
+    return result;
 }
 
-void DRV8214::setRippleSpeed(uint16_t speed) {
+uint8_t DRV8214::setRippleSpeed(uint16_t speed) {
+    DRV8214_API_SCOPE();
     if (speed > motor_max_rpm) { speed = motor_max_rpm; } // Cap speed to the maximum RPM of the motor
 
     // Find the corresponding ripples frequency (Hz) value
-    uint32_t ripple_speed = (speed * motor_reduction_ratio * ripples_per_revolution * 2 * M_PI) / 60;
+    uint32_t ripple_speed = (speed * ripples_per_shaft_revolution * 2 * M_PI) / 60;
 
     // Define max feasible ripple speed based on 8-bit WSET_VSET and max scaling factor (128)
     const uint16_t MAX_SPEED = 32640; // 255 * 128 = 32640 rad/s
@@ -449,57 +828,60 @@ void DRV8214::setRippleSpeed(uint16_t speed) {
             }
         }
     }
-    config.w_scale = scaleOptions[W_SCALE].scale;
 
     WSET_VSET = WSET_VSET & 0xFF; // Ensure WSET_VSET fits within 8 bits
 
-    if (config.verbose) {
-        char buffer[256];  // Adjust the buffer size as needed
-        snprintf(buffer, sizeof(buffer), "WSET_VSET: %d | W_SCALE: %d or 0b%d | Effective Target Speed: %d rad/s\n", WSET_VSET, config.w_scale, W_SCALE, WSET_VSET * config.w_scale);
-        drvPrint(buffer);
-    }
-    drv8214_i2c_write_register(address, DRV8214_REG_CTRL1, WSET_VSET);
-    drv8214_i2c_modify_register_bits(address, DRV8214_REG_CTRL0, REG_CTRL0_W_SCALE, W_SCALE);
+    DRV8214_LOG(RIPPLE_SPEED, WSET_VSET, scaleOptions[W_SCALE].scale, W_SCALE, WSET_VSET * scaleOptions[W_SCALE].scale);
+    uint16_t errors = bus_errors;
+    regWrite(DRV8214_REG_CTRL1, WSET_VSET);
+    writeFields(FIELD_REG_CTRL0_W_SCALE::set(W_SCALE));
+    return busStatus(errors);
 }
 
-void DRV8214::setVoltageSpeed(float voltage) {
+uint8_t DRV8214::setVoltageSpeed(float voltage) {
+    DRV8214_API_SCOPE();
     if (voltage < 0.0f) { voltage = 0.0f; } // Ensure voltage is non-negative
 
     // Depending on the VM_GAIN_SEL bit (voltage_range), clamp and scale accordingly
-    if (config.voltage_range) {
+    if (shadowField<FIELD_CONFIG0_VM_GAIN_SEL>()) {
         // VM_GAIN_SEL = 1 → Range: 0 to 3.92 V
         if (voltage > 3.92f) { voltage = 3.92f; }
         // Apply formula from table 8-23: WSET_VSET = voltage * (255 / 3.92)
         float scaled = voltage * (255.0f / 3.92f);
         uint8_t regVal = static_cast<uint8_t>(scaled + 0.5f); // Round to nearest integer
-        drv8214_i2c_write_register(address, DRV8214_REG_CTRL1, regVal);
+        return regWrite(DRV8214_REG_CTRL1, regVal);
     } else {
         // VM_GAIN_SEL = 0 → Range: 0 to 15.7 V
         if (voltage > 15.7f) { voltage = 11.0f; } // Cap voltage to 11 V because of Overvoltage Protection
         // Apply formula from table 8-23: WSET_VSET = voltage * (255 / 15.7)
         float scaled = voltage * (255.0f / 15.7f);
         uint8_t regVal = static_cast<uint8_t>(scaled + 0.5f); // Round to nearest integer
-        drv8214_i2c_write_register(address, DRV8214_REG_CTRL1, regVal);
+        return regWrite(DRV8214_REG_CTRL1, regVal);
     }
 }
 
-void DRV8214::configureControl2(uint8_t control2) {
-    drv8214_i2c_write_register(address, DRV8214_REG_CTRL2, control2);
+uint8_t DRV8214::configureControl2(uint8_t control2) {
+    DRV8214_API_SCOPE();
+    return regWrite(DRV8214_REG_CTRL2, control2);
 }
 
-void DRV8214::enableRippleCount(bool enable) {
-    drv8214_i2c_modify_register(address, DRV8214_RC_CTRL0, RC_CTRL0_EN_RC, enable);
+uint8_t DRV8214::enableRippleCount(bool enable) {
+    DRV8214_API_SCOPE();
+    return writeFields(FIELD_RC_CTRL0_EN_RC::set(enable));
 }
 
-void DRV8214::enableErrorCorrection(bool enable) {
-    drv8214_i2c_modify_register(address, DRV8214_RC_CTRL0, RC_CTRL0_DIS_EC, !enable);
+uint8_t DRV8214::enableErrorCorrection(bool enable) {
+    DRV8214_API_SCOPE();
+    return writeFields(FIELD_RC_CTRL0_DIS_EC::set(!enable));
 }
 
-void DRV8214::configureRippleCount0(uint8_t ripple0) {
-    drv8214_i2c_write_register(address, DRV8214_RC_CTRL0, ripple0);
+uint8_t DRV8214::configureRippleCount0(uint8_t ripple0) {
+    DRV8214_API_SCOPE();
+    return regWrite(DRV8214_RC_CTRL0, ripple0);
 }
 
-void DRV8214::setRippleCountThreshold(uint16_t threshold) {
+uint8_t DRV8214::setRippleCountThreshold(uint16_t threshold) {
+    DRV8214_API_SCOPE();
     // Define max feasible threshold based on 10-bit RC_THR and max scaling factor (64)
     const uint16_t MAX_THRESHOLD = 65535; // 1024 * 64 = 65536
     
@@ -534,47 +916,43 @@ void DRV8214::setRippleCountThreshold(uint16_t threshold) {
             }
         }
     }
-    if (config.verbose) {
-        char buffer[256];  // Adjust the buffer size as needed
-        snprintf(buffer, sizeof(buffer), "RC_THR: %d | RC_THR_SCALE: %d ", rc_thr, rc_thr_scale_bits);
-        drvPrint(buffer);
-    }
-    config.ripple_threshold = rc_thr;
-    config.ripple_threshold_scale = rc_thr_scale_bits;
+    DRV8214_LOG(RIPPLE_THRESHOLD, rc_thr, rc_thr_scale_bits);
     // Ensure rc_thr fits within 10 bits
     rc_thr = rc_thr & 0x3FF;
     
     // Split into lower 8 bits and upper 2 bits
     uint8_t rc_thr_low  = rc_thr & 0xFF;         // bits 7..0
     uint8_t rc_thr_high = (rc_thr >> 8) & 0x03;  // bits 9..8
-    drv8214_i2c_write_register(address, DRV8214_RC_CTRL1, rc_thr_low);
-    setRippleThresholdScale(rc_thr_scale_bits);
-    drv8214_i2c_modify_register_bits(address, DRV8214_RC_CTRL2, RC_CTRL2_RC_THR_HIGH, rc_thr_high);
+    uint16_t errors = bus_errors;
+    regWrite(DRV8214_RC_CTRL1, rc_thr_low);
+    writeFields(FIELD_RC_CTRL2_RC_THR_SCALE::set(rc_thr_scale_bits) | FIELD_RC_CTRL2_RC_THR_HIGH::set(rc_thr_high));
+    return busStatus(errors);
 }
 
-void DRV8214::setRippleThresholdScale(uint8_t scale) {
-    scale = scale & 0x03;
-    scale = scale << 2; //make sure the 2 bits of scale are placed on bit 2 and 3
-    drv8214_i2c_modify_register_bits(address, DRV8214_RC_CTRL2, RC_CTRL2_RC_THR_SCALE, scale);
+uint8_t DRV8214::setRippleThresholdScale(uint8_t scale) {
+    DRV8214_API_SCOPE();
+    return writeFields(FIELD_RC_CTRL2_RC_THR_SCALE::set(scale)); // Placed on bits 2 and 3
 }
 
-void DRV8214::setKMCScale(uint8_t scale) {
-    scale = scale << 4; //make sure the 2 bits of scale are placed on bit 4 and 5
-    drv8214_i2c_modify_register_bits(address, DRV8214_RC_CTRL2, RC_CTRL2_KMC_SCALE, scale);
+uint8_t DRV8214::setKMCScale(uint8_t scale) {
+    DRV8214_API_SCOPE();
+    if (scale > FIELD_RC_CTRL2_KMC_SCALE::max_value) { scale = FIELD_RC_CTRL2_KMC_SCALE::max_value; } // Cap scale to 0b11
+    return writeFields(FIELD_RC_CTRL2_KMC_SCALE::set(scale)); // Placed on bits 4 and 5
 }
 
-void DRV8214::setMotorInverseResistance(uint8_t resistance) {
-    drv8214_i2c_write_register(address, DRV8214_RC_CTRL3, resistance);
+uint8_t DRV8214::setMotorInverseResistance(uint8_t resistance) {
+    DRV8214_API_SCOPE();
+    return regWrite(DRV8214_RC_CTRL3, resistance);
 }
 
-void DRV8214::setMotorInverseResistanceScale(uint8_t scale) {
-    scale = scale << 6; //make sure the 2 bits of scale are placed on bit 6 and 7
-    drv8214_i2c_modify_register_bits(address, DRV8214_RC_CTRL2, RC_CTRL2_INV_R_SCALE, scale);
+uint8_t DRV8214::setMotorInverseResistanceScale(uint8_t scale) {
+    DRV8214_API_SCOPE();
+    return writeFields(FIELD_RC_CTRL2_INV_R_SCALE::set(scale)); // Placed on bits 6 and 7
 }
 
-void DRV8214::setResistanceRelatedParameters() {
-    // Possible values of INV_R_SCALE and corresponding register bit settings
-    const uint16_t scaleValues[4] = {2, 64, 1024, 8192};
+uint8_t DRV8214::setResistanceRelatedParameters() {
+    DRV8214_API_SCOPE();
+    // Register bit settings of the INV_R_SCALE values in drv_inv_r_scales
     const uint8_t scaleBits[4] = {0b00, 0b01, 0b10, 0b11};
 
     // Default values (minimum valid values)
@@ -584,7 +962,7 @@ void DRV8214::setResistanceRelatedParameters() {
     // Iterate from largest scale to smallest for best resolution
     for (int i = 3; i >= 0; --i)
     {
-        float candidate = scaleValues[i] / motor_internal_resistance;
+        float candidate = drv_inv_r_scales[i] / motor_internal_resistance;
         float rounded = roundf(candidate);
 
         // Ensure the value is at least 1
@@ -600,72 +978,89 @@ void DRV8214::setResistanceRelatedParameters() {
             break;
         }
     }
-    config.inv_r = bestInvR;
-    config.inv_r_scale = scaleValues[bestScaleBits];
 
+    uint16_t errors = bus_errors;
     // Set the selected INV_R and INV_R_SCALE
     setMotorInverseResistanceScale(bestScaleBits);
     setMotorInverseResistance(bestInvR);
+    return busStatus(errors);
 }
 
-void DRV8214::setKMC(uint8_t factor) {
-    drv8214_i2c_write_register(address, DRV8214_RC_CTRL4, factor);
+uint8_t DRV8214::setKMC(uint8_t factor) {
+    DRV8214_API_SCOPE();
+    return regWrite(DRV8214_RC_CTRL4, factor);
 }
 
-void DRV8214::setFilterDamping(uint8_t damping) {
-    drv8214_i2c_write_register(address, DRV8214_RC_CTRL5, damping);
+uint8_t DRV8214::setFilterDamping(uint8_t damping) {
+    DRV8214_API_SCOPE();
+    return regWrite(DRV8214_RC_CTRL5, damping);
 }
 
-void DRV8214::configureRippleCount6(uint8_t ripple6) {
-    drv8214_i2c_write_register(address, DRV8214_RC_CTRL6, ripple6);
+uint8_t DRV8214::configureRippleCount6(uint8_t ripple6) {
+    DRV8214_API_SCOPE();
+    return regWrite(DRV8214_RC_CTRL6, ripple6);
 }
 
-void DRV8214::configureRippleCount7(uint8_t ripple7) {
-    drv8214_i2c_write_register(address, DRV8214_RC_CTRL7, ripple7);
+uint8_t DRV8214::configureRippleCount7(uint8_t ripple7) {
+    DRV8214_API_SCOPE();
+    return regWrite(DRV8214_RC_CTRL7, ripple7);
 }
 
-void DRV8214::configureRippleCount8(uint8_t ripple8) {
-    drv8214_i2c_write_register(address, DRV8214_RC_CTRL8, ripple8);
+uint8_t DRV8214::configureRippleCount8(uint8_t ripple8) {
+    DRV8214_API_SCOPE();
+    return regWrite(DRV8214_RC_CTRL8, ripple8);
 }
 
 // --- Motor Control Functions ---
-void DRV8214::setControlMode(ControlMode mode, bool I2CControl) {
-    config.control_mode = mode;
-    setI2CControl(I2CControl);
-    switch (mode) {
-        case PWM:
-            enablePWMControl();
-            break;
-        case PH_EN:
-            enablePHENControl();
-            break;
-    }
+uint8_t DRV8214::setControlMode(ControlMode mode, bool I2CControl) {
+    DRV8214_API_SCOPE();
+    return writeFields(FIELD_CONFIG4_I2C_BC::set(I2CControl) | FIELD_CONFIG4_PMODE::set(mode == PWM));
 }
 
-void DRV8214::setRegulationMode(RegulationMode regulation) {
+uint8_t DRV8214::setRegulationMode(RegulationMode regulation) {
+    DRV8214_API_SCOPE();
+    uint16_t errors = bus_errors;
     uint8_t reg_ctrl = 0;  // Default value
     switch (regulation) {
         case CURRENT_FIXED:
-            reg_ctrl = (0b00 << 3);  // Fixed Off-Time Current Regulation
+            reg_ctrl = 0b00;  // Fixed Off-Time Current Regulation
             break;
         case CURRENT_CYCLES:
-            reg_ctrl = (0b01 << 3);  // Cycle-By-Cycle Current Regulation
+            reg_ctrl = 0b01;  // Cycle-By-Cycle Current Regulation
             break;
         case SPEED:
-            reg_ctrl = (0b10 << 3);  // Speed Regulation
+            reg_ctrl = 0b10;  // Speed Regulation
             enableRippleCount();
             break;
         case VOLTAGE:
-            reg_ctrl = (0b11 << 3);  // Voltage Regulation
+            reg_ctrl = 0b11;  // Voltage Regulation
             break;
     }
-    config.regulation_mode = regulation;
-    drv8214_i2c_modify_register_bits(address, DRV8214_REG_CTRL0, REG_CTRL0_REG_CTRL, reg_ctrl);
+    writeFields(FIELD_REG_CTRL0_REG_CTRL::set(reg_ctrl));
+    return busStatus(errors);
+}
+
+uint8_t DRV8214::turnForward(uint16_t speed, float voltage, float requested_current) {
+    DRV8214_API_SCOPE();
+    uint8_t status = armSoftLimit(true);
+    if (status != DRV8214_OK) { return status; }
+    engageBacklash(true);
+    return driveForward(speed, voltage, requested_current);
+}
+
+uint8_t DRV8214::turnReverse(uint16_t speed, float voltage, float requested_current) {
+    DRV8214_API_SCOPE();
+    uint8_t status = armSoftLimit(false);
+    if (status != DRV8214_OK) { return status; }
+    engageBacklash(false);
+    return driveReverse(speed, voltage, requested_current);
 }
 
-void DRV8214::turnForward(uint16_t speed, float voltage, float requested_current) {
+uint8_t DRV8214::driveForward(uint16_t speed, float voltage, float requested_current) {
+    uint16_t errors = bus_errors;
+    setMotionDirection(1);
     disableHbridge();
-    switch (config.regulation_mode) {
+    switch (regulationMode()) {
         case CURRENT_FIXED: // No speed control if using I2C (will applied full tension to motor)
             setRegulationAndStallCurrent(requested_current);
             break;
@@ -680,23 +1075,24 @@ void DRV8214::turnForward(uint16_t speed, float voltage, float requested_current
             break;
     }
     
-    if (config.control_mode == PWM) {
+    if (controlMode() == PWM) {
         // Table 8-5 => Forward => Input1=1, Input2=0
-        drv8214_i2c_modify_register(address, DRV8214_CONFIG4, CONFIG4_I2C_EN_IN1, true);  // Input1=1
-        drv8214_i2c_modify_register(address, DRV8214_CONFIG4, CONFIG4_I2C_PH_IN2, false); // Input2=0
+        writeFields(FIELD_CONFIG4_I2C_EN_IN1::set(true) | FIELD_CONFIG4_I2C_PH_IN2::set(false)); // Input1=1, Input2=0
     } 
     else { // PH/EN mode
         // Table 8-4 => Forward => EN=1, PH=1
-        drv8214_i2c_modify_register(address, DRV8214_CONFIG4, CONFIG4_I2C_EN_IN1, true); // EN=1
-        drv8214_i2c_modify_register(address, DRV8214_CONFIG4, CONFIG4_I2C_PH_IN2, true); // PH=1
+        writeFields(FIELD_CONFIG4_I2C_EN_IN1::set(true) | FIELD_CONFIG4_I2C_PH_IN2::set(true)); // EN=1, PH=1
     }
     enableHbridge();
-    if (config.verbose) { drvPrint("Turning Forward\n"); }
+    DRV8214_LOG(TURN_FORWARD);
+    return busStatus(errors);
 }
 
-void DRV8214::turnReverse(uint16_t speed, float voltage, float requested_current) {
+uint8_t DRV8214::driveReverse(uint16_t speed, float voltage, float requested_current) {
+    uint16_t errors = bus_errors;
+    setMotionDirection(-1);
     enableHbridge();
-    switch (config.regulation_mode) {
+    switch (regulationMode()) {
         case CURRENT_FIXED: // No speed control if using I2C (will applied full tension to motor)
             setRegulationAndStallCurrent(requested_current);
             break;
@@ -710,63 +1106,541 @@ void DRV8214::turnReverse(uint16_t speed, float voltage, float requested_current
             setVoltageSpeed(voltage);
             break;
     }
-    if (config.control_mode == PWM) {
+    if (controlMode() == PWM) {
         // Table 8-5 => Reverse => Input1=0, Input2=1
-        drv8214_i2c_modify_register(address, DRV8214_CONFIG4, CONFIG4_I2C_EN_IN1, false);
-        drv8214_i2c_modify_register(address, DRV8214_CONFIG4, CONFIG4_I2C_PH_IN2, true);
+        writeFields(FIELD_CONFIG4_I2C_EN_IN1::set(false) | FIELD_CONFIG4_I2C_PH_IN2::set(true));
     } 
     else { // PH/EN mode
         // Table 8-4 => Reverse => EN=1, PH=0
-        drv8214_i2c_modify_register(address, DRV8214_CONFIG4, CONFIG4_I2C_EN_IN1, true);
-        drv8214_i2c_modify_register(address, DRV8214_CONFIG4, CONFIG4_I2C_PH_IN2, false);
+        writeFields(FIELD_CONFIG4_I2C_EN_IN1::set(true) | FIELD_CONFIG4_I2C_PH_IN2::set(false));
     }
-    if (config.verbose) { drvPrint("Turning Reverse\n"); }
+    DRV8214_LOG(TURN_REVERSE);
+    return busStatus(errors);
 }
 
-void DRV8214::brakeMotor(bool initial_config) {
+uint8_t DRV8214::brakeMotor(bool initial_config) {
+    DRV8214_API_SCOPE();
+    uint16_t errors = bus_errors;
     enableHbridge();
-    if (config.control_mode == PWM) {
+    releaseSoftLimit();
+    if (controlMode() == PWM) {
         // Table 8-5 => Brake => Input1=1, Input2=1 => both outputs low
-        drv8214_i2c_modify_register(address, DRV8214_CONFIG4, CONFIG4_I2C_EN_IN1, true);
-        drv8214_i2c_modify_register(address, DRV8214_CONFIG4, CONFIG4_I2C_PH_IN2, true);
+        writeFields(FIELD_CONFIG4_I2C_EN_IN1::set(true) | FIELD_CONFIG4_I2C_PH_IN2::set(true));
     }
     else { // PH/EN mode
         // Table 8-4 => Brake => EN=0 => outputs go low
-        drv8214_i2c_modify_register(address, DRV8214_CONFIG4, CONFIG4_I2C_EN_IN1, false);
         // PH can be 0 or 1, the datasheet shows "X" => still brake with EN=0
-        drv8214_i2c_modify_register(address, DRV8214_CONFIG4, CONFIG4_I2C_PH_IN2, false);
+        writeFields(FIELD_CONFIG4_I2C_EN_IN1::set(false) | FIELD_CONFIG4_I2C_PH_IN2::set(false));
     }
-    if (config.verbose & !initial_config) { drvPrint("Braking Motor\n"); }
+    if (!initial_config) { DRV8214_LOG(BRAKE); }
+    return busStatus(errors);
 }
 
-void DRV8214::coastMotor() {
+uint8_t DRV8214::coastMotor() {
+    DRV8214_API_SCOPE();
+    uint16_t errors = bus_errors;
     enableHbridge();
-    if (config.control_mode == PWM) {
+    releaseSoftLimit();
+    if (controlMode() == PWM) {
         // Table 8-5 => Coast => Input1=0, Input2=0 => High-Z while awake
-        drv8214_i2c_modify_register(address, DRV8214_CONFIG4, CONFIG4_I2C_EN_IN1, false);
-        drv8214_i2c_modify_register(address, DRV8214_CONFIG4, CONFIG4_I2C_PH_IN2, false);
+        writeFields(FIELD_CONFIG4_I2C_EN_IN1::set(false) | FIELD_CONFIG4_I2C_PH_IN2::set(false));
     }
     else {
         // PH/EN mode has no "coast" state in the datasheet table. There's no official high-Z while awake.
         // We could do "sleep" or "brake," or just do nothing here;
-        drvPrint("PH/EN mode does not support coast (High-Z) while awake.");
+        DRV8214_LOG(COAST_UNSUPPORTED);
     }
-    if (config.verbose) { drvPrint("Coasting Motor\n"); }
-}
-
-void DRV8214::turnXRipples(uint16_t ripples_target, bool stops, bool direction, uint16_t speed, float voltage, float requested_current) {
+    DRV8214_LOG(COAST);
+    return busStatus(errors);
+}
+
+uint8_t DRV8214::turnXRipples(uint16_t ripples_target, bool stops, bool direction, uint16_t speed, float voltage, float requested_current) {
+    DRV8214_API_SCOPE();
+    if (soft_limits_enabled && !stops) {
+        // The motor keeps running past the target: bounded like a continuous move, the chip stops it at the limit
+        uint8_t status = armSoftLimit(direction);
+        if (status != DRV8214_OK) { return status; }
+        engageBacklash(direction);
+        return drive(direction, speed, voltage, requested_current);
+    }
+    // First move after a reversal: the motor has to cross the backlash band before the output shaft moves
+    int8_t side = direction ? 1 : -1;
+    uint16_t band = (backlash_side == -side) ? backlash_ripples : 0;
+    if (soft_limits_enabled) {
+        updatePosition();
+        int32_t room = softLimitRoom(direction); // The band included, it does not move the output
+        if (room - band < 1 || room < 2) { // No output travel left, or below the smallest threshold the chip can count
+            brakeMotor();
+            return DRV8214_ERR_LIMIT;
+        }
+        if ((int32_t)ripples_target >= room - band) {
+            if (!soft_limit_clip) { return DRV8214_ERR_LIMIT; }
+            // Let the chip stop the motor at the boundary (RC_HIZ), the threshold scaling rounds 2 or more down
+            saveSoftLimitState();
+            ripples_target = (uint16_t)(room - band);
+        }
+        soft_limit_armed = true; // Stops at the target, within the limits
+    }
+    uint32_t compensated = (uint32_t)ripples_target + band;
+    ripples_target = (compensated > 0xFFFF) ? 0xFFFF : compensated;
+    uint16_t errors = bus_errors;
     setRippleCountThreshold(ripples_target);
     resetRippleCounter();
-    if (stops != config.bridge_behavior_thr_reached) { setBridgeBehaviorThresholdReached(stops); } // Set bridge behavior if different
-    if (direction) { turnForward(speed, voltage, requested_current); } else { turnReverse(speed, voltage, requested_current); }
+    if (stops != (bool)shadowField<FIELD_RC_CTRL0_RC_HIZ>()) { setBridgeBehaviorThresholdReached(stops); } // Set bridge behavior if different
+    engageBacklash(direction);
+    drive(direction, speed, voltage, requested_current);
+    return busStatus(errors);
+}
+
+uint8_t DRV8214::turnXRevolutions(uint16_t revolutions_target, bool stops, bool direction, uint16_t speed, float voltage, float requested_current) {
+    DRV8214_API_SCOPE();
+
+    uint32_t ripples_target = (uint32_t)(revolutions_target * ripples_per_shaft_revolution + 0.5f);
+    if (ripples_target > 0xFFFF) { ripples_target = 0xFFFF; } // Cap to the 16-bit ripple counter
+    return turnXRipples(ripples_target, stops, direction, speed, voltage, requested_current);
+}
+
+uint8_t DRV8214::home(const DRV8214_HomingConfig& homing, DRV8214_HomingResult* result) {
+    DRV8214_API_SCOPE();
+    uint32_t start = drv8214_time_millis();
+    DRV8214_HomingResult res = { DRV8214_OK, 0, 0, 0 };
+
+    // Reduced current limit so the hard stop is hit softly
+    SavedState saved;
+    beginStallSequence(saved, homing.stall_current);
+
+    // Drive to the hard stop
+    drive(homing.direction, homing.speed, homing.voltage, homing.stall_current);
+    res.status = waitForFault(FAULT_STALL, homing.timeout_ms, homing.poll_interval_ms, homing.nfault_asserted);
+    res.time_to_stop_ms = drv8214_time_millis() - start;
+    res.ripples_to_stop = getRippleCount();
+    brakeMotor();
+
+    if (res.status == DRV8214_OK) {
+        backlash_side = homing.direction ? 1 : -1; // Pressed against the stop, the gearbox sits on this flank
+        // Back off from the stop, the H-bridge is released by the chip itself when the threshold is reached
+        resetFaultFlags();
+        turnXRipples(homing.backoff_ripples, true, !homing.direction, homing.speed, homing.voltage, homing.stall_current);
+        res.status = waitForFault(FAULT_CNT_DONE, homing.backoff_timeout_ms, homing.poll_interval_ms, homing.nfault_asserted);
+        brakeMotor();
+        if (res.status == DRV8214_OK) {
+            resetRippleCounter();
+            zeroPosition();
+            backlash_offset = 0; // The output shaft is the reference after homing
+        }
+    }
+
+    endStallSequence(saved);
+    res.total_time_ms = drv8214_time_millis() - start;
+
+    DRV8214_LOG(HOMING, res.status, (unsigned long)res.time_to_stop_ms, res.ripples_to_stop, (unsigned long)res.total_time_ms);
+    if (result) { *result = res; }
+    return res.status;
+}
+
+uint8_t DRV8214::traverseToStall(bool direction, uint16_t speed, float voltage, float current, uint32_t timeout_ms, uint16_t poll_interval_ms) {
+    // Same as waitForFault() but keeps the odometry up to date, for traverses longer than the 16-bit ripple counter
+    drive(direction, speed, voltage, current);
+    uint32_t start = drv8214_time_millis();
+    uint8_t status = DRV8214_ERR_TIMEOUT;
+    while (drv8214_time_millis() - start < timeout_ms) {
+        DRV8214_Status snapshot;
+        if (readStatus(snapshot) != DRV8214_OK) { status = DRV8214_ERR_BUS; break; }
+        updatePosition(snapshot);
+        if (snapshot.fault & FAULT_STALL) { status = DRV8214_OK; break; }
+        if (snapshot.fault & (FAULT_OCP | FAULT_OVP | FAULT_TSD)) { status = DRV8214_ERR_FAULT; break; }
+        drv8214_time_delay_ms(poll_interval_ms);
+    }
+    brakeMotor();
+    updatePosition();
+    return status;
+}
+
+uint8_t DRV8214::waitForFault(uint8_t fault_mask, uint32_t timeout_ms, uint16_t poll_interval_ms, bool (*nfault_asserted)(uint8_t)) {
+    uint32_t start = drv8214_time_millis();
+    while (drv8214_time_millis() - start < timeout_ms) {
+        // When the nFAULT pin is available, only go on the bus once it is pulled low
+        if (nfault_asserted == nullptr || nfault_asserted(driver_ID)) {
+            uint8_t fault;
+            if (regReadBurst(DRV8214_FAULT, &fault, 1) != DRV8214_OK) { return DRV8214_ERR_BUS; }
+            if (fault & fault_mask) { return DRV8214_OK; }
+            if (fault & (FAULT_OCP | FAULT_OVP | FAULT_TSD)) { return DRV8214_ERR_FAULT; }
+        }
+        drv8214_time_delay_ms(poll_interval_ms);
+    }
+    return DRV8214_ERR_TIMEOUT;
+}
+
+void DRV8214::beginStallSequence(SavedState& saved, float stall_current) {
+    releaseSoftLimit(); // Saved below as the user left it, not as the last limited move did
+    // Save everything the sequence changes, endStallSequence() restores it
+    saved.config0 = shadow[DRV8214_CONFIG0 - DRV8214_CONFIG0];
+    saved.config3 = shadow[DRV8214_CONFIG3 - DRV8214_CONFIG0];
+    saved.config4 = shadow[DRV8214_CONFIG4 - DRV8214_CONFIG0];
+    saved.rc_ctrl0 = shadow[DRV8214_RC_CTRL0 - DRV8214_CONFIG0];
+    saved.rc_ctrl1 = shadow[DRV8214_RC_CTRL1 - DRV8214_CONFIG0];
+    saved.rc_ctrl2 = shadow[DRV8214_RC_CTRL2 - DRV8214_CONFIG0];
+    saved.soft_limits_enabled = soft_limits_enabled;
+    soft_limits_enabled = false; // Hard stops lie outside the soft limits by definition
+
+    // Outputs are disabled on stall, and not on a ripple threshold left over from a previous move
+    setStallDetection(true);
+    setStallBehavior(false);
+    setBridgeBehaviorThresholdReached(false);
+    setRegulationAndStallCurrent(stall_current);
+    enableStallInterrupt();
+    resetFaultFlags();
+    resetRippleCounter();
+}
+
+void DRV8214::endStallSequence(const SavedState& saved) {
+    setStallDetection(FIELD_CONFIG0_EN_STALL::decode(saved.config0));
+    setStallBehavior(FIELD_CONFIG3_SMODE::decode(saved.config3));
+    writeFields(FIELD_RC_CTRL0_RC_HIZ::set(FIELD_RC_CTRL0_RC_HIZ::decode(saved.rc_ctrl0)) |
+                FIELD_RC_CTRL0_CS_GAIN_SEL::set(FIELD_RC_CTRL0_CS_GAIN_SEL::decode(saved.rc_ctrl0)));
+    writeFields(FIELD_CONFIG4_STALL_REP::set(FIELD_CONFIG4_STALL_REP::decode(saved.config4)));
+    // Ripple threshold left by the back-off or calibration moves
+    regWrite(DRV8214_RC_CTRL1, saved.rc_ctrl1);
+    writeFields(FIELD_RC_CTRL2_RC_THR_SCALE::set(FIELD_RC_CTRL2_RC_THR_SCALE::decode(saved.rc_ctrl2)) |
+                FIELD_RC_CTRL2_RC_THR_HIGH::set(FIELD_RC_CTRL2_RC_THR_HIGH::decode(saved.rc_ctrl2)));
+    soft_limits_enabled = saved.soft_limits_enabled;
+}
+
+uint8_t DRV8214::drive(bool direction, uint16_t speed, float voltage, float requested_current) {
+    return direction ? driveForward(speed, voltage, requested_current) : driveReverse(speed, voltage, requested_current);
+}
+
+// --- Odometry Functions ---
+
+void DRV8214::setMotionDirection(int8_t direction) {
+    // The ripple counter does not know the direction, account the ripples of the previous motion before reversing
+    if (direction != motion_direction) {
+        updatePosition();
+        motion_direction = direction;
+    }
+}
+
+int32_t DRV8214::updatePosition() {
+    DRV8214_API_SCOPE();
+    uint8_t raw[2];
+    if (regReadBurst(DRV8214_RC_STATUS2, raw, sizeof(raw)) != DRV8214_OK) { return position; } // Keep the last known position
+    uint16_t count = (raw[1] << 8) | raw[0];
+    position += motion_direction * (int32_t)(uint16_t)(count - last_ripple_count);
+    last_ripple_count = count;
+    return position;
+}
+
+int32_t DRV8214::updatePosition(const DRV8214_Status& status) {
+    DRV8214_API_SCOPE();
+    position += motion_direction * (int32_t)(uint16_t)(status.ripple_count - last_ripple_count);
+    last_ripple_count = status.ripple_count;
+    return position;
+}
+
+int32_t DRV8214::getPosition() {
+    return position;
+}
+
+void DRV8214::setPosition(int32_t new_position) {
+    DRV8214_API_SCOPE();
+    updatePosition(); // Ripples counted until now belong to the previous reference
+    position = new_position;
+}
+
+void DRV8214::zeroPosition() {
+    DRV8214_API_SCOPE();
+    setPosition(0);
+}
+
+// --- Soft Limit Functions ---
+
+void DRV8214::setSoftLimits(int32_t min_position, int32_t max_position, bool clip) {
+    soft_limit_min = min_position;
+    soft_limit_max = max_position;
+    soft_limit_clip = clip;
+    soft_limits_enabled = true;
+    soft_limit_armed = false;
+}
+
+void DRV8214::disableSoftLimits() {
+    DRV8214_API_SCOPE();
+    soft_limits_enabled = false;
+    releaseSoftLimit();
+}
+
+void DRV8214::saveSoftLimitState() {
+    // Only the first override of a move is kept: it holds what the user had programmed
+    if (soft_limit_saved || !shadow_valid) { return; }
+    memcpy(soft_limit_saved_regs, &shadow[DRV8214_RC_CTRL0 - DRV8214_CONFIG0], sizeof(soft_limit_saved_regs));
+    soft_limit_saved = true;
+}
+
+void DRV8214::releaseSoftLimit() {
+    soft_limit_armed = false;
+    if (!soft_limit_saved) { return; }
+    soft_limit_saved = false;
+    writeFields(FIELD_RC_CTRL0_RC_HIZ::set(FIELD_RC_CTRL0_RC_HIZ::decode(soft_limit_saved_regs[0])));
+    regWrite(DRV8214_RC_CTRL1, soft_limit_saved_regs[1]);
+    writeFields(FIELD_RC_CTRL2_RC_THR_SCALE::set(FIELD_RC_CTRL2_RC_THR_SCALE::decode(soft_limit_saved_regs[2])) |
+                FIELD_RC_CTRL2_RC_THR_HIGH::set(FIELD_RC_CTRL2_RC_THR_HIGH::decode(soft_limit_saved_regs[2])));
+}
+
+int32_t DRV8214::softLimitRoom(bool direction) {
+    // The limits bound the output shaft: a move starting with a reversal (before engageBacklash()) may also spend the
+    // backlash band, which does not move the output
+    int32_t output = position - backlash_offset;
+    int32_t room = direction ? (soft_limit_max - output) : (output - soft_limit_min);
+    if (backlash_side == (direction ? -1 : 1)) { room += backlash_ripples; }
+    return room;
+}
+
+uint8_t DRV8214::armSoftLimit(bool direction) {
+    if (!soft_limits_enabled) { return DRV8214_OK; }
+    // Continuous move: let the chip stop at the boundary by itself if it is within reach of the ripple threshold
+    resetRippleCounter(); // Also brings the position up to date
+    int32_t room = softLimitRoom(direction);
+    if (room < 2) { // A threshold of 1 would be programmed as 2 ripples, one past the limit
+        brakeMotor();
+        return DRV8214_ERR_LIMIT;
+    }
+    saveSoftLimitState();
+    if (room <= 0xFFFF) {
+        setRippleCountThreshold(room);
+        setBridgeBehaviorThresholdReached(true);
+        soft_limit_armed = true;
+    } else {
+        // Too far for the 16-bit counter, enforceSoftLimits() arms the threshold once the limit gets close
+        setRippleCountThreshold(0xFFFF);
+        setBridgeBehaviorThresholdReached(false);
+        soft_limit_armed = false;
+    }
+    return DRV8214_OK;
+}
+
+uint8_t DRV8214::enforceSoftLimits() {
+    DRV8214_API_SCOPE();
+    // To be called periodically during long moves, costs one burst read while the limit is out of reach
+    if (!soft_limits_enabled) { return DRV8214_OK; }
+    updatePosition();
+    int32_t room = softLimitRoom(motion_direction > 0);
+    if (room <= 0) {
+        brakeMotor();
+        return DRV8214_ERR_LIMIT;
+    }
+    if (!soft_limit_armed && room <= 0xFFFF) {
+        // Shrink the hardware threshold to the remaining distance, the chip stops itself at the boundary
+        resetRippleCounter();
+        room = softLimitRoom(motion_direction > 0);
+        if (room < 2) { // Too close for the smallest threshold (2 ripples)
+            brakeMotor();
+            return DRV8214_ERR_LIMIT;
+        }
+        saveSoftLimitState();
+        setRippleCountThreshold(room);
+        setBridgeBehaviorThresholdReached(true);
+        soft_limit_armed = true;
+    }
+    return DRV8214_OK;
 }
 
-void DRV8214::turnXRevolutions(uint16_t revolutions_target, bool stops, bool direction, uint16_t speed, float voltage, float requested_current) {
+// --- Backlash Functions ---
 
-    uint8_t ripples_target = revolutions_target * ripples_per_revolution * motor_reduction_ratio;
-    turnXRipples(ripples_target, stops, direction, speed, voltage, requested_current);
+void DRV8214::setBacklash(uint16_t ripples) {
+    backlash_ripples = ripples;
 }
 
+uint16_t DRV8214::getBacklash() {
+    return backlash_ripples;
+}
+
+int8_t DRV8214::getBacklashSide() {
+    return backlash_side;
+}
+
+int32_t DRV8214::getOutputPosition() {
+    return position - backlash_offset;
+}
+
+void DRV8214::engageBacklash(bool direction) {
+    // Moves are assumed to travel at least the backlash band, the new flank is engaged once they end
+    int8_t side = direction ? 1 : -1;
+    if (backlash_side == -side) {
+        backlash_offset += side * (int32_t)backlash_ripples;
+    }
+    backlash_side = side;
+}
+
+uint8_t DRV8214::calibrateRipplesPerRevolution(const DRV8214_RippleCalibration& calibration, float* measured) {
+    DRV8214_API_SCOPE();
+    uint8_t status = DRV8214_ERR_TIMEOUT;
+    float ripples = 0.0f;
+
+    if (calibration.index_reached) {
+        // Count the motor ripples between index marks over several output shaft revolutions.
+        // The odometry absorbs the 16-bit counter wrap-around on long measurements.
+        uint16_t edges = 0;
+        int32_t first_position = 0;
+        bool previous = calibration.index_reached(driver_ID);
+        uint32_t last_update = drv8214_time_millis();
+        uint32_t start = last_update;
+
+        drive(calibration.direction, calibration.speed, calibration.voltage, calibration.stall_current); // 0 A would select the 0.125 A range
+        while (drv8214_time_millis() - start < calibration.timeout_ms) {
+            bool index = calibration.index_reached(driver_ID);
+            if (index && !previous) {
+                // Same detection latency on the first and last mark, it cancels out
+                updatePosition();
+                if (edges == 0) {
+                    first_position = position;
+                } else if (edges == calibration.index_revolutions) {
+                    int32_t travel = position - first_position;
+                    ripples = (float)(travel < 0 ? -travel : travel) / calibration.index_revolutions;
+                    status = DRV8214_OK;
+                    break;
+                }
+                edges++;
+            }
+            previous = index;
+            if (drv8214_time_millis() - last_update >= calibration.poll_interval_ms) {
+                updatePosition();
+                last_update = drv8214_time_millis();
+            }
+        }
+        brakeMotor();
+    } else if (calibration.traverse_revolutions > 0.0f) {
+        // Stall to stall over a known travel, the backlash band is crossed once when leaving the first stop
+        SavedState saved;
+        beginStallSequence(saved, calibration.stall_current);
+        status = traverseToStall(!calibration.direction, calibration.speed, calibration.voltage, calibration.stall_current, calibration.timeout_ms, calibration.poll_interval_ms);
+        if (status == DRV8214_OK) {
+            resetFaultFlags();
+            int32_t first_position = position;
+            status = traverseToStall(calibration.direction, calibration.speed, calibration.voltage, calibration.stall_current, calibration.timeout_ms, calibration.poll_interval_ms);
+            resetFaultFlags();
+            int32_t travel = position - first_position;
+            travel = (travel < 0 ? -travel : travel) - backlash_ripples;
+            ripples = (float)travel / calibration.traverse_revolutions;
+        }
+        endStallSequence(saved);
+    } else {
+        status = DRV8214_ERR_INVALID; // Neither an index sensor nor a known traverse length
+    }
+
+    if (status == DRV8214_OK && ripples > 0.0f) {
+        ripples_per_shaft_revolution = ripples;
+    }
+    if (measured) { *measured = ripples; }
+    return status;
+}
+
+uint8_t DRV8214::calibrateBacklash(const DRV8214_BacklashCalibration& calibration, uint16_t* measured) {
+    DRV8214_API_SCOPE();
+    SavedState saved;
+    beginStallSequence(saved, calibration.stall_current);
+    uint8_t status;
+    uint16_t ripples = 0;
+
+    if (calibration.output_locked) {
+        // Output shaft held: stall on the first flank, then count the ripples until the opposite flank stalls
+        drive(calibration.direction, calibration.speed, calibration.voltage, calibration.stall_current);
+        status = waitForFault(FAULT_STALL, calibration.timeout_ms, calibration.poll_interval_ms, nullptr);
+        brakeMotor();
+        if (status == DRV8214_OK) {
+            resetFaultFlags();
+            resetRippleCounter();
+            drive(!calibration.direction, calibration.speed, calibration.voltage, calibration.stall_current);
+            status = waitForFault(FAULT_STALL, calibration.timeout_ms, calibration.poll_interval_ms, nullptr);
+            ripples = getRippleCount();
+            brakeMotor();
+            resetFaultFlags();
+        }
+    } else {
+        // Free output with a load: take up the slack, reverse and watch for the load current once the flank engages
+        setRippleCountThreshold(calibration.takeup_ripples);
+        setBridgeBehaviorThresholdReached(true);
+        resetRippleCounter();
+        drive(calibration.direction, calibration.speed, calibration.voltage, calibration.stall_current);
+        status = waitForFault(FAULT_CNT_DONE, calibration.timeout_ms, calibration.poll_interval_ms, nullptr);
+        brakeMotor();
+        if (status == DRV8214_OK) {
+            resetRippleCounter();
+            drive(!calibration.direction, calibration.speed, calibration.voltage, calibration.stall_current);
+            status = DRV8214_ERR_TIMEOUT;
+            uint32_t start = drv8214_time_millis();
+            while (drv8214_time_millis() - start < calibration.timeout_ms) {
+                DRV8214_Status snapshot;
+                if (readStatus(snapshot) != DRV8214_OK) { status = DRV8214_ERR_BUS; break; }
+                if (snapshot.fault & (FAULT_OCP | FAULT_OVP | FAULT_TSD)) { status = DRV8214_ERR_FAULT; break; }
+                if (snapshot.ripple_count >= calibration.max_ripples) { break; }
+                if (snapshot.ripple_count >= calibration.ignore_ripples && convertMotorCurrent(snapshot.current) >= calibration.engage_current) {
+                    ripples = snapshot.ripple_count;
+                    status = DRV8214_OK;
+                    break;
+                }
+                drv8214_time_delay_ms(calibration.poll_interval_ms);
+            }
+            brakeMotor();
+        }
+    }
+
+    endStallSequence(saved);
+    if (status == DRV8214_OK) {
+        backlash_ripples = ripples;
+        backlash_side = calibration.direction ? -1 : 1; // Last move engaged the opposite flank
+    }
+    if (measured) { *measured = ripples; }
+    return status;
+}
+
+// --- Asynchronous Functions ---
+
+void DRV8214::onStatusTransfer(const DRV8214_AsyncOp& op, uint8_t result, void* context) {
+    (void)op;
+    DRV8214* driver = static_cast<DRV8214*>(context);
+    driver->async_status_state = (result == DRV8214_ASYNC_DONE) ? ASYNC_READY : ASYNC_FAILED;
+}
+
+uint8_t DRV8214::requestStatus() {
+    DRV8214_API_SCOPE();
+    if (async_status_state == ASYNC_PENDING) { return DRV8214_ERR_BUSY; }
+    async_status_state = ASYNC_PENDING;
+    if (!drv8214_async_read(address, DRV8214_FAULT, async_status_raw, sizeof(async_status_raw), onStatusTransfer, this)) {
+        async_status_state = ASYNC_IDLE;
+        return DRV8214_ERR_BUSY; // Queue full
+    }
+    return DRV8214_OK;
+}
+
+bool DRV8214::isStatusReady() {
+    return async_status_state == ASYNC_READY;
+}
+
+uint8_t DRV8214::takeStatus(DRV8214_Status& status) {
+    DRV8214_API_SCOPE();
+    switch (async_status_state) {
+        case ASYNC_PENDING: return DRV8214_ERR_BUSY;
+        case ASYNC_FAILED:  async_status_state = ASYNC_IDLE; return DRV8214_ERR_BUS;
+        case ASYNC_READY:   break;
+        default:            return DRV8214_ERR_INVALID; // Nothing requested
+    }
+    decodeStatus(async_status_raw, status);
+    async_status_state = ASYNC_IDLE;
+    uint8_t result = DRV8214_OK;
+    if ((status.fault & FAULT_NPOR) && shadow_valid) { result = handlePowerOnReset(); }
+    updatePosition(status);
+    return result;
+}
+
+uint8_t DRV8214::requestRegulationTarget(uint8_t target) {
+    DRV8214_API_SCOPE();
+    // The payload is copied into the queue, nothing to wait for
+    if (!drv8214_async_write(address, DRV8214_REG_CTRL1, &target, 1, nullptr, nullptr)) { return DRV8214_ERR_BUSY; }
+    shadowStore(DRV8214_REG_CTRL1, &target, 1); // Not a drift for the scrubber
+    return DRV8214_OK;
+}
+
+// --- Other Functions ---
+
 void DRV8214::printMotorConfig(bool initial_config) {
     char buffer[256];  // Adjust the buffer size as needed
     
@@ -779,20 +1653,20 @@ void DRV8214::printMotorConfig(bool initial_config) {
         drvPrint(buffer);
     }
     snprintf(buffer, sizeof(buffer),
-        "Address: 0x%02X | Sense Resistor: %d Ohms | Ripples per Rotor Revolution: %d | Ripples per Shaft Revolution: %d\n",
-        address, Ripropri, ripples_per_revolution, ripples_per_revolution * motor_reduction_ratio);
+        "Address: 0x%02X | Sense Resistor: %d Ohms | Ripples per Rotor Revolution: %d | Ripples per Shaft Revolution: %.2f\n",
+        address, Ripropri, ripples_per_revolution, ripples_per_shaft_revolution);
     drvPrint(buffer);
     
     snprintf(buffer, sizeof(buffer), "Configuration: OVP: %s | STALL detect: %s | I2C controlled: %s | Mode: %s",
-        config.voltage_range ? "Enabled" : "Disabled",
-        config.stall_enabled ? "Enabled" : "Disabled",
-        config.I2CControlled ? "Yes" : "No",
-        (config.control_mode == PWM) ? "PWM" : "PH_EN");
+        shadowField<FIELD_CONFIG0_EN_OVP>() ? "Enabled" : "Disabled",
+        shadowField<FIELD_CONFIG0_EN_STALL>() ? "Enabled" : "Disabled",
+        shadowField<FIELD_CONFIG4_I2C_BC>() ? "Yes" : "No",
+        (controlMode() == PWM) ? "PWM" : "PH_EN");
     drvPrint(buffer);
     
     // Regulation mode details
     drvPrint(" | Regulation: ");
-    switch (config.regulation_mode) {
+    switch (regulationMode()) {
         case CURRENT_FIXED:   drvPrint("CURRENT_FIXED\n"); break;
         case CURRENT_CYCLES:  drvPrint("CURRENT_CYCLES\n"); break;
         case SPEED:           drvPrint("SPEED\n"); break;
@@ -801,24 +1675,25 @@ void DRV8214::printMotorConfig(bool initial_config) {
     
     snprintf(buffer, sizeof(buffer),
         "Vref: %.3f | Current Reg. Mode: %d | VRange: %s \n",
-            config.Vref, config.current_reg_mode,
-            config.voltage_range ? "0V-3.92V" : "0V-15.7V");
+            vref_mv / 1000.0f, shadowField<FIELD_CONFIG3_IMODE>(),
+            shadowField<FIELD_CONFIG0_VM_GAIN_SEL>() ? "0V-3.92V" : "0V-15.7V");
     drvPrint(buffer);
 
     snprintf(buffer, sizeof(buffer),
         "Stall Behavior: %s | Bridge Behavior Thr. reached: %s\n",
-        config.stall_behavior ? "Drive current" : "Disable outputs",
-        config.bridge_behavior_thr_reached ? "H-bridge disabled" : "H-bridge stays enabled");
+        shadowField<FIELD_CONFIG3_SMODE>() ? "Drive current" : "Disable outputs",
+        shadowField<FIELD_RC_CTRL0_RC_HIZ>() ? "H-bridge disabled" : "H-bridge stays enabled");
     drvPrint(buffer);
 
     snprintf(buffer, sizeof(buffer),
         "Inrush Duration: %d ms | INV_R: %d | INV_R_SCALE: %d\n",
-        config.inrush_duration, config.inv_r, config.inv_r_scale);
+        (shadow[DRV8214_CONFIG1 - DRV8214_CONFIG0] << 8) | shadow[DRV8214_CONFIG2 - DRV8214_CONFIG0],
+        shadow[DRV8214_RC_CTRL3 - DRV8214_CONFIG0], drv_inv_r_scales[shadowField<FIELD_RC_CTRL2_INV_R_SCALE>()]);
     drvPrint(buffer);
 
     snprintf(buffer, sizeof(buffer),
         "KMC: %d | KMCScale: %d\n",
-        config.kmc, config.kmc_scale);
+        shadow[DRV8214_RC_CTRL4 - DRV8214_CONFIG0], shadowField<FIELD_RC_CTRL2_KMC_SCALE>());
     drvPrint(buffer);
 }
 
@@ -833,12 +1708,26 @@ void DRV8214::drvPrint(const char* msg) {
     
         // Option 2: If you have retargeted printf to UART, you could simply use:
         printf("%s", msg);
+    #elif defined(DRV8214_PLATFORM_LINUX)
+        fputs(msg, stdout);
     #endif
 }
 
+#if DRV8214_LOG_MODE == DRV8214_LOG_TEXT
+void DRV8214::drvPrintf(const char* format, ...) {
+    char buffer[128];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    drvPrint(buffer);
+}
+#endif
+
 void DRV8214::printFaultStatus() {
+    DRV8214_API_SCOPE();
     char buffer[256];  // Buffer for formatted output
-    uint8_t faultReg = drv8214_i2c_read_register(address, DRV8214_FAULT);
+    uint8_t faultReg = regRead(DRV8214_FAULT);
 
     snprintf(buffer, sizeof(buffer), "DRV8214 Driver %d - FAULT Register Status:\n", driver_ID);
     drvPrint(buffer);
@@ -874,6 +1763,33 @@ void DRV8214::printFaultStatus() {
     }
 }
 
+uint8_t DRV8214::printRegisters() {
+    DRV8214_API_SCOPE();
+    uint8_t image[DRV8214_REG_COUNT];
+    if (readRegisters(image) != DRV8214_OK) { return DRV8214_ERR_BUS; }
+    char buffer[48];
+    snprintf(buffer, sizeof(buffer), "DRV8214 Driver %d - Registers:\n", driver_ID);
+    drvPrint(buffer);
+    drv8214_regmap_print_dump(image, printLine, this);
+
+    uint8_t expected[DRV8214_REG_COUNT];
+    getExpectedImage(expected);
+    DRV8214_FieldDiff diffs[16];
+    uint8_t count = drv8214_regmap_diff(image, expected, diffs, 16);
+    if (count > 16) {
+        snprintf(buffer, sizeof(buffer), "%d fields differ, first 16:\n", count);
+        drvPrint(buffer);
+        count = 16;
+    }
+    drv8214_regmap_print_diff(diffs, count, printLine, this);
+    drv8214_regmap_print_checks(drv8214_regmap_validate(image), printLine, this);
+    return DRV8214_OK;
+}
+
+void DRV8214::printLine(const char* line, void* context) {
+    static_cast<DRV8214*>(context)->drvPrint(line);
+}
+
 #ifdef DRV8214_PLATFORM_ARDUINO
     void DRV8214::setDebugStream(Stream* debugPort) {
         _debugPort = debugPort;
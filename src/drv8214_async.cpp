@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+#include "drv8214_async.h"
+#include "drv8214_platform_time.h"
+
+#ifdef DRV8214_PLATFORM_STM32
+    // The queue is shared with the I2C interrupt
+    #define DRV8214_ASYNC_LOCK()    uint32_t drv_async_primask = __get_PRIMASK(); __disable_irq()
+    #define DRV8214_ASYNC_UNLOCK()  __set_PRIMASK(drv_async_primask)
+#else
+    #define DRV8214_ASYNC_LOCK()    do { } while (0)
+    #define DRV8214_ASYNC_UNLOCK()  do { } while (0)
+#endif
+
+struct DRV8214_AsyncEntry {
+    DRV8214_AsyncOp       op;
+    uint8_t               payload[DRV8214_BUS_MAX_BURST]; // Write data, owned by the queue while the DMA reads it
+    DRV8214_AsyncCallback callback;
+    void*                 context;
+    #ifdef DRV8214_PLATFORM_LINUX
+        bool              started;      // Transfer already run through the bus policy
+        uint32_t          queued_us;    // Virtual time of the submission
+        uint32_t          end_us;       // Virtual time of the completion
+        uint8_t           result;       // Outcome of the transfer, reported at completion
+    #endif
+};
+
+// The oldest entry (head) is the transfer in flight
+static DRV8214_AsyncEntry drv_async_queue[DRV8214_ASYNC_QUEUE_SIZE];
+static volatile uint8_t   drv_async_head = 0;
+static volatile uint8_t   drv_async_count = 0;
+
+#ifdef DRV8214_PLATFORM_LINUX
+    static uint32_t drv_async_clock_us = 0;     // Virtual bus clock
+    static uint32_t drv_async_bus_free_us = 0;  // Virtual time at which the last started transfer ends
+#endif
+
+// Remove the head entry and report its result. The entry is copied first, the callback may submit into the freed slot.
+static void drv_async_complete(uint8_t result) {
+    DRV8214_AsyncEntry done;
+    {
+        DRV8214_ASYNC_LOCK();
+        done = drv_async_queue[drv_async_head];
+        drv_async_head = (drv_async_head + 1) % DRV8214_ASYNC_QUEUE_SIZE;
+        drv_async_count = drv_async_count - 1;
+        DRV8214_ASYNC_UNLOCK();
+    }
+    if (!done.op.read) { done.op.data = done.payload; }
+    if (done.callback) { done.callback(done.op, result, done.context); }
+}
+
+#ifdef DRV8214_PLATFORM_STM32
+
+// Start the head transfer, operations the HAL refuses are completed with an error
+static void drv_async_start() {
+    while (drv_async_count > 0) {
+        DRV8214_AsyncEntry& entry = drv_async_queue[drv_async_head];
+        HAL_StatusTypeDef status = HAL_ERROR;
+        if (drv8214_i2c_handle != NULL) {
+            // STM32 HAL expects the 7-bit address to be shifted left by 1
+            if (entry.op.read) {
+                status = HAL_I2C_Mem_Read_DMA(drv8214_i2c_handle, (uint16_t)(entry.op.address << 1), entry.op.reg, I2C_MEMADD_SIZE_8BIT, entry.op.data, entry.op.length);
+            } else {
+                status = HAL_I2C_Mem_Write_DMA(drv8214_i2c_handle, (uint16_t)(entry.op.address << 1), entry.op.reg, I2C_MEMADD_SIZE_8BIT, entry.payload, entry.op.length);
+            }
+        }
+        if (status == HAL_OK) { return; }
+        drv_async_complete(DRV8214_ASYNC_ERROR);
+    }
+}
+
+void drv8214_async_irq_handler(I2C_HandleTypeDef* hi2c, bool success) {
+    if (hi2c != drv8214_i2c_handle || drv_async_count == 0) { return; } // Transfer not issued by this module
+    drv_async_complete(success ? DRV8214_ASYNC_DONE : DRV8214_ASYNC_ERROR);
+    drv_async_start();
+}
+
+#ifdef DRV8214_ASYNC_HAL_CALLBACKS
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef* hi2c) { drv8214_async_irq_handler(hi2c, true); }
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef* hi2c) { drv8214_async_irq_handler(hi2c, true); }
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef* hi2c) { drv8214_async_irq_handler(hi2c, false); }
+#endif
+
+#else
+
+// Fallback backends: the transfer runs through the compile-time bus policy
+static uint8_t drv_async_run(DRV8214_AsyncEntry& entry) {
+    typedef DRV8214_RegisterAccess<DRV8214_BUS_POLICY> Bus;
+    uint8_t result;
+    if (entry.op.read) {
+        result = Bus::readBurst(entry.op.address, entry.op.reg, entry.op.data, entry.op.length);
+    } else {
+        result = Bus::writeBurst(entry.op.address, entry.op.reg, entry.payload, entry.op.length);
+    }
+    return (result == DRV8214_I2C_OK) ? DRV8214_ASYNC_DONE : DRV8214_ASYNC_ERROR;
+}
+
+#endif
+
+#ifdef DRV8214_PLATFORM_LINUX
+
+static void drv_async_start() {
+    if (drv_async_count == 0) { return; }
+    DRV8214_AsyncEntry& entry = drv_async_queue[drv_async_head];
+    if (entry.started) { return; }
+    uint32_t begin = (int32_t)(entry.queued_us - drv_async_bus_free_us) > 0 ? entry.queued_us : drv_async_bus_free_us;
+    entry.end_us = begin + drv8214_bus_transfer_us(entry.op.read, entry.op.length, DRV8214_ASYNC_FAKE_BUS_HZ);
+    entry.started = true;
+    drv_async_bus_free_us = entry.end_us;
+    entry.result = drv_async_run(entry);
+}
+
+void drv8214_async_fake_advance(uint32_t dt_us) {
+    drv_async_clock_us += dt_us;
+    drv8214_async_poll();
+}
+
+uint32_t drv8214_async_fake_time() {
+    return drv_async_clock_us;
+}
+
+void drv8214_async_fake_reset() {
+    drv_async_head = 0;
+    drv_async_count = 0;
+    drv_async_clock_us = 0;
+    drv_async_bus_free_us = 0;
+}
+
+#endif
+
+// --- Queue Functions ---
+
+bool drv8214_async_submit(const DRV8214_AsyncOp& op, DRV8214_AsyncCallback callback, void* context) {
+    if (op.length == 0 || op.length > DRV8214_BUS_MAX_BURST || op.data == nullptr) { return false; }
+    bool idle;
+    {
+        DRV8214_ASYNC_LOCK();
+        if (drv_async_count >= DRV8214_ASYNC_QUEUE_SIZE) {
+            DRV8214_ASYNC_UNLOCK();
+            return false;
+        }
+        DRV8214_AsyncEntry& entry = drv_async_queue[(drv_async_head + drv_async_count) % DRV8214_ASYNC_QUEUE_SIZE];
+        entry.op = op;
+        if (!op.read) { memcpy(entry.payload, op.data, op.length); }
+        entry.callback = callback;
+        entry.context = context;
+        #ifdef DRV8214_PLATFORM_LINUX
+            entry.started = false;
+            entry.queued_us = drv_async_clock_us;
+        #endif
+        idle = (drv_async_count == 0);
+        drv_async_count = drv_async_count + 1;
+        DRV8214_ASYNC_UNLOCK();
+    }
+    #if defined(DRV8214_PLATFORM_STM32) || defined(DRV8214_PLATFORM_LINUX)
+        if (idle) { drv_async_start(); } // Nothing in flight, the bus is ours
+    #else
+        (void)idle; // Started from drv8214_async_poll()
+    #endif
+    return true;
+}
+
+bool drv8214_async_read(uint8_t address, uint8_t reg, uint8_t* data, uint8_t length, DRV8214_AsyncCallback callback, void* context) {
+    DRV8214_AsyncOp op = { address, reg, length, true, data };
+    return drv8214_async_submit(op, callback, context);
+}
+
+bool drv8214_async_write(uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length, DRV8214_AsyncCallback callback, void* context) {
+    DRV8214_AsyncOp op = { address, reg, length, false, (uint8_t*)data };
+    return drv8214_async_submit(op, callback, context);
+}
+
+uint8_t drv8214_async_pending() {
+    return drv_async_count;
+}
+
+void drv8214_async_poll() {
+    #if defined(DRV8214_PLATFORM_LINUX)
+        while (drv_async_count > 0) {
+            drv_async_start();
+            if ((int32_t)(drv_async_queue[drv_async_head].end_us - drv_async_clock_us) > 0) { break; } // Still on the bus
+            drv_async_complete(drv_async_queue[drv_async_head].result);
+        }
+    #elif defined(DRV8214_PLATFORM_ARDUINO)
+        while (drv_async_count > 0) {
+            drv_async_complete(drv_async_run(drv_async_queue[drv_async_head]));
+        }
+    #endif
+    // STM32: completions are delivered from the I2C interrupt
+}
+
+bool drv8214_async_flush(uint32_t timeout_ms) {
+    #if defined(DRV8214_PLATFORM_LINUX)
+        // Jump the virtual clock from one completion to the next
+        uint32_t start = drv_async_clock_us;
+        while (drv_async_count > 0) {
+            drv_async_start();
+            uint32_t end = drv_async_queue[drv_async_head].end_us;
+            if (end - start > timeout_ms * 1000) { return false; }
+            if ((int32_t)(end - drv_async_clock_us) > 0) { drv_async_clock_us = end; }
+            drv8214_async_poll();
+        }
+        return true;
+    #else
+        uint32_t start = drv8214_time_millis();
+        while (drv_async_count > 0) {
+            drv8214_async_poll();
+            if (drv_async_count > 0 && drv8214_time_millis() - start > timeout_ms) { return false; }
+        }
+        return true;
+    #endif
+}
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+#include "drv8214_convert.h"
+
+#if !defined(DRV8214_CONVERT_SCALAR) && (defined(__SSE2__) || defined(_M_X64))
+    #define DRV8214_CONVERT_SSE2
+    #include <emmintrin.h>
+#elif !defined(DRV8214_CONVERT_SCALAR) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+    #define DRV8214_CONVERT_NEON
+    #include <arm_neon.h>
+#endif
+
+// Vector loops convert 16 samples per iteration: one 128-bit load of raw bytes widened into four vectors of four floats.
+// The conversions are exact integer to float widenings followed by one IEEE multiplication (and a min), the same
+// operations as the scalar functions, so both paths round identically. The remaining samples go through the scalar code.
+#define DRV8214_CONVERT_BLOCK 16
+
+// Duty cycle: x * 100 / 63 for x <= 63 is (x * 100 * 16645) >> 20, in 16-bit lanes
+#define DRV8214_DUTY_MAGIC 16645
+
+#if defined(DRV8214_CONVERT_SSE2)
+
+static inline void drv_widen(const uint8_t* raw, __m128 out[4]) {
+    __m128i zero  = _mm_setzero_si128();
+    __m128i bytes = _mm_loadu_si128((const __m128i*)raw);
+    __m128i lo    = _mm_unpacklo_epi8(bytes, zero);
+    __m128i hi    = _mm_unpackhi_epi8(bytes, zero);
+    out[0] = _mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero));
+    out[1] = _mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero));
+    out[2] = _mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero));
+    out[3] = _mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero));
+}
+
+static uint32_t drv_voltage_block(const uint8_t* raw, const float* scale, const float* max, float* out, uint32_t count) {
+    uint32_t i = 0;
+    for (; i + DRV8214_CONVERT_BLOCK <= count; i += DRV8214_CONVERT_BLOCK) {
+        __m128 samples[4];
+        drv_widen(raw + i, samples);
+        for (uint8_t k = 0; k < 4; k++) {
+            __m128 volts = _mm_mul_ps(samples[k], _mm_loadu_ps(scale + i + 4 * k));
+            _mm_storeu_ps(out + i + 4 * k, _mm_min_ps(volts, _mm_loadu_ps(max + i + 4 * k))); // volts < max ? volts : max
+        }
+    }
+    return i;
+}
+
+static uint32_t drv_scale_block(const uint8_t* raw, const float* scale, float* out, uint32_t count) {
+    uint32_t i = 0;
+    for (; i + DRV8214_CONVERT_BLOCK <= count; i += DRV8214_CONVERT_BLOCK) {
+        __m128 samples[4];
+        drv_widen(raw + i, samples);
+        for (uint8_t k = 0; k < 4; k++) {
+            _mm_storeu_ps(out + i + 4 * k, _mm_mul_ps(samples[k], _mm_loadu_ps(scale + i + 4 * k)));
+        }
+    }
+    return i;
+}
+
+static uint32_t drv_duty_block(const uint8_t* raw, uint8_t* out, uint32_t count) {
+    uint32_t i = 0;
+    __m128i zero = _mm_setzero_si128();
+    for (; i + DRV8214_CONVERT_BLOCK <= count; i += DRV8214_CONVERT_BLOCK) {
+        __m128i bytes = _mm_and_si128(_mm_loadu_si128((const __m128i*)(raw + i)), _mm_set1_epi8(0x3F));
+        __m128i lo = _mm_mullo_epi16(_mm_unpacklo_epi8(bytes, zero), _mm_set1_epi16(100));
+        __m128i hi = _mm_mullo_epi16(_mm_unpackhi_epi8(bytes, zero), _mm_set1_epi16(100));
+        lo = _mm_srli_epi16(_mm_mulhi_epu16(lo, _mm_set1_epi16(DRV8214_DUTY_MAGIC)), 4);
+        hi = _mm_srli_epi16(_mm_mulhi_epu16(hi, _mm_set1_epi16(DRV8214_DUTY_MAGIC)), 4);
+        _mm_storeu_si128((__m128i*)(out + i), _mm_packus_epi16(lo, hi));
+    }
+    return i;
+}
+
+#elif defined(DRV8214_CONVERT_NEON)
+
+static inline void drv_widen(const uint8_t* raw, float32x4_t out[4]) {
+    uint8x16_t bytes = vld1q_u8(raw);
+    uint16x8_t lo    = vmovl_u8(vget_low_u8(bytes));
+    uint16x8_t hi    = vmovl_u8(vget_high_u8(bytes));
+    out[0] = vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo)));
+    out[1] = vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo)));
+    out[2] = vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi)));
+    out[3] = vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi)));
+}
+
+static uint32_t drv_voltage_block(const uint8_t* raw, const float* scale, const float* max, float* out, uint32_t count) {
+    uint32_t i = 0;
+    for (; i + DRV8214_CONVERT_BLOCK <= count; i += DRV8214_CONVERT_BLOCK) {
+        float32x4_t samples[4];
+        drv_widen(raw + i, samples);
+        for (uint8_t k = 0; k < 4; k++) {
+            float32x4_t volts = vmulq_f32(samples[k], vld1q_f32(scale + i + 4 * k));
+            vst1q_f32(out + i + 4 * k, vminq_f32(volts, vld1q_f32(max + i + 4 * k))); // No NaN here, same as volts < max ? volts : max
+        }
+    }
+    return i;
+}
+
+static uint32_t drv_scale_block(const uint8_t* raw, const float* scale, float* out, uint32_t count) {
+    uint32_t i = 0;
+    for (; i + DRV8214_CONVERT_BLOCK <= count; i += DRV8214_CONVERT_BLOCK) {
+        float32x4_t samples[4];
+        drv_widen(raw + i, samples);
+        for (uint8_t k = 0; k < 4; k++) {
+            vst1q_f32(out + i + 4 * k, vmulq_f32(samples[k], vld1q_f32(scale + i + 4 * k)));
+        }
+    }
+    return i;
+}
+
+static inline uint8x8_t drv_duty_half(uint8x8_t bytes) {
+    uint16x8_t scaled = vmulq_n_u16(vmovl_u8(bytes), 100);
+    uint16x4_t lo = vshrn_n_u32(vmull_n_u16(vget_low_u16(scaled), DRV8214_DUTY_MAGIC), 16);
+    uint16x4_t hi = vshrn_n_u32(vmull_n_u16(vget_high_u16(scaled), DRV8214_DUTY_MAGIC), 16);
+    return vmovn_u16(vshrq_n_u16(vcombine_u16(lo, hi), 4));
+}
+
+static uint32_t drv_duty_block(const uint8_t* raw, uint8_t* out, uint32_t count) {
+    uint32_t i = 0;
+    for (; i + DRV8214_CONVERT_BLOCK <= count; i += DRV8214_CONVERT_BLOCK) {
+        uint8x16_t bytes = vandq_u8(vld1q_u8(raw + i), vdupq_n_u8(0x3F));
+        vst1q_u8(out + i, vcombine_u8(drv_duty_half(vget_low_u8(bytes)), drv_duty_half(vget_high_u8(bytes))));
+    }
+    return i;
+}
+
+#else
+
+static uint32_t drv_voltage_block(const uint8_t*, const float*, const float*, float*, uint32_t) { return 0; }
+static uint32_t drv_scale_block(const uint8_t*, const float*, float*, uint32_t) { return 0; }
+static uint32_t drv_duty_block(const uint8_t*, uint8_t*, uint32_t) { return 0; }
+
+#endif
+
+// --- Batch Kernels ---
+
+void drv8214_convert_voltage_batch(const uint8_t* raw, const float* volts_per_lsb, const float* volts_max, float* volts, uint32_t count) {
+    for (uint32_t i = drv_voltage_block(raw, volts_per_lsb, volts_max, volts, count); i < count; i++) {
+        volts[i] = drv8214_convert_voltage(raw[i], volts_per_lsb[i], volts_max[i]);
+    }
+}
+
+void drv8214_convert_current_batch(const uint8_t* raw, const float* amps_per_lsb, float* amps, uint32_t count) {
+    for (uint32_t i = drv_scale_block(raw, amps_per_lsb, amps, count); i < count; i++) {
+        amps[i] = drv8214_convert_current(raw[i], amps_per_lsb[i]);
+    }
+}
+
+void drv8214_convert_duty_batch(const uint8_t* raw, uint8_t* percent, uint32_t count) {
+    for (uint32_t i = drv_duty_block(raw, percent, count); i < count; i++) {
+        percent[i] = drv8214_convert_duty(raw[i]);
+    }
+}
+
+void drv8214_convert_speed_batch(const uint8_t* raw, const float* rpm_per_lsb, float* rpm, uint32_t count) {
+    for (uint32_t i = drv_scale_block(raw, rpm_per_lsb, rpm, count); i < count; i++) {
+        rpm[i] = drv8214_convert_speed(raw[i], rpm_per_lsb[i]);
+    }
+}
+
+const char* drv8214_convert_isa() {
+    #if defined(DRV8214_CONVERT_SSE2)
+        return "sse2";
+    #elif defined(DRV8214_CONVERT_NEON)
+        return "neon";
+    #else
+        return "scalar";
+    #endif
+}
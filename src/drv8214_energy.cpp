@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+#include "drv8214_energy.h"
+
+void DRV8214EnergyMeter::reset() {
+    energy = 0.0f;
+    copper_loss = 0.0f;
+    peak_power = 0.0f;
+    last_power = 0.0f;
+    last_loss = 0.0f;
+    winding_temperature = config.ambient_temperature;
+    last_timestamp_us = 0;
+    has_sample = false;
+}
+
+void DRV8214EnergyMeter::update(const DRV8214_Status& status, uint32_t timestamp_us) {
+    float voltage = driver.convertMotorVoltage(status.voltage);
+    float current = driver.convertMotorCurrent(status.current);
+    float power = voltage * current;
+    float loss = current * current * driver.getMotorInternalResistance(); // I²R dissipated in the winding
+
+    if (power > peak_power) { peak_power = power; }
+
+    if (has_sample) {
+        uint32_t dt_us = timestamp_us - last_timestamp_us; // Unsigned subtraction handles the timer wrap-around
+        if (dt_us <= config.max_sample_gap_us) {
+            float dt = dt_us * 1e-6f;
+            // Trapezoidal integration between the two snapshots
+            energy += 0.5f * (power + last_power) * dt;
+            copper_loss += 0.5f * (loss + last_loss) * dt;
+
+            // First-order thermal model, exact discretisation for a constant loss over dt:
+            // T tends to Tamb + P * Rth with the time constant tau
+            float steady_state = config.ambient_temperature + 0.5f * (loss + last_loss) * config.thermal_resistance;
+            float k = 1.0f - expf(-dt / config.thermal_time_constant);
+            winding_temperature += (steady_state - winding_temperature) * k;
+        }
+    }
+
+    last_power = power;
+    last_loss = loss;
+    last_timestamp_us = timestamp_us;
+    has_sample = true;
+}
+
+float DRV8214EnergyMeter::getSpeedRatio() const {
+    if (winding_temperature <= config.derating_temperature) { return 1.0f; }
+    if (winding_temperature >= config.max_temperature) { return config.min_speed_ratio; }
+    // Linear derating between derating_temperature and max_temperature
+    float t = (winding_temperature - config.derating_temperature) / (config.max_temperature - config.derating_temperature);
+    return 1.0f - t * (1.0f - config.min_speed_ratio);
+}
+
+uint16_t DRV8214EnergyMeter::throttleSpeed(uint16_t speed) const {
+    return (uint16_t)(speed * getSpeedRatio());
+}
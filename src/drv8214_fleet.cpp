@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+#include "drv8214_fleet.h"
+
+// Branch-free loops over the columns with no early exit, they vectorise at -O3 (or -O2 -ftree-vectorize). The snapshots
+// are read with a stride of 8 bytes, a power of two the vectoriser handles with shuffles.
+
+void drv8214_fleet_decode_status(const uint8_t* __restrict raw, uint16_t count, uint8_t* __restrict fault, uint8_t* __restrict speed,
+                                 uint16_t* __restrict ripple_count, uint8_t* __restrict voltage, uint8_t* __restrict current,
+                                 uint8_t* __restrict duty) {
+    for (uint16_t i = 0; i < count; i++) {
+        const uint8_t* snapshot = raw + i * DRV8214_FLEET_SLOT_BYTES;
+        fault[i]        = snapshot[DRV8214_FAULT];
+        speed[i]        = snapshot[DRV8214_RC_STATUS1];
+        ripple_count[i] = (uint16_t)((snapshot[DRV8214_RC_STATUS3] << 8) | snapshot[DRV8214_RC_STATUS2]);
+        voltage[i]      = snapshot[DRV8214_REG_STATUS1];
+        current[i]      = snapshot[DRV8214_REG_STATUS2];
+        duty[i]         = snapshot[DRV8214_REG_STATUS3];
+    }
+}
+
+void drv8214_fleet_update_odometry(const uint16_t* __restrict ripple_count, uint16_t* __restrict last_ripple_count,
+                                   const int8_t* __restrict direction, int32_t* __restrict position, uint16_t count) {
+    for (uint16_t i = 0; i < count; i++) {
+        uint16_t delta = (uint16_t)(ripple_count[i] - last_ripple_count[i]); // The 16-bit counter wraps around
+        position[i] += direction[i] * (int32_t)delta;
+        last_ripple_count[i] = ripple_count[i];
+    }
+}
+
+uint16_t drv8214_fleet_check_faults(const uint8_t* __restrict fault, uint8_t mask, uint8_t* __restrict flagged, uint16_t count) {
+    uint32_t total = 0;
+    for (uint16_t i = 0; i < count; i++) {
+        uint8_t bits = fault[i] & mask;
+        flagged[i] = bits;
+        total += (bits != 0);
+    }
+    return (uint16_t)total;
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+#include "drv8214_latency.h"
+
+#if DRV8214_LATENCY
+
+#include <stdio.h>
+#include <string.h>
+
+static_assert(DRV8214_LATENCY_HISTOGRAMS < 255, "Slots hold the histogram index + 1 in a byte");
+static_assert(DRV8214_LATENCY_APIS < DRV8214_LATENCY_NONE, "API ids are bytes");
+static_assert(DRV8214_LATENCY_BUCKETS == 4 * 25, "4 buckets per power of two up to 2^26 us");
+
+struct DRV8214_LatencyHistogram {
+    uint32_t buckets[DRV8214_LATENCY_BUCKETS];
+    uint32_t max_us;
+    uint64_t total_us;
+    uint8_t  api;
+    uint8_t  driver_id;
+};
+
+uint32_t (*drv8214_latency_clock)() = drv8214_time_micros;
+
+static DRV8214_LatencyHistogram drv8214_latency_pool[DRV8214_LATENCY_HISTOGRAMS];
+static uint8_t     drv8214_latency_used = 0;
+static const char* drv8214_latency_names[DRV8214_LATENCY_APIS];
+static uint8_t     drv8214_latency_name_count = 0;
+static uint32_t    drv8214_latency_lost = 0;
+
+void drv8214_latency_set_clock(uint32_t (*clock)()) {
+    drv8214_latency_clock = clock ? clock : drv8214_time_micros;
+}
+
+uint8_t drv8214_latency_register(const char* api) {
+    if (drv8214_latency_name_count >= DRV8214_LATENCY_APIS) { return DRV8214_LATENCY_NONE; }
+    drv8214_latency_names[drv8214_latency_name_count] = api;
+    return drv8214_latency_name_count++;
+}
+
+void drv8214_latency_record(uint8_t* slots, uint8_t driver_id, uint8_t api, uint32_t us) {
+    if (api == DRV8214_LATENCY_NONE) {
+        drv8214_latency_lost++;
+        return;
+    }
+    uint8_t slot = slots[api];
+    if (slot == 0) { // First call of this method by this driver
+        if (drv8214_latency_used >= DRV8214_LATENCY_HISTOGRAMS) {
+            drv8214_latency_lost++;
+            return;
+        }
+        DRV8214_LatencyHistogram& histogram = drv8214_latency_pool[drv8214_latency_used];
+        histogram.api = api;
+        histogram.driver_id = driver_id;
+        slot = ++drv8214_latency_used;
+        slots[api] = slot;
+    }
+    DRV8214_LatencyHistogram& histogram = drv8214_latency_pool[slot - 1];
+    histogram.buckets[drv8214_latency_bucket(us)]++;
+    histogram.total_us += us;
+    if (us > histogram.max_us) { histogram.max_us = us; }
+}
+
+uint8_t drv8214_latency_count() {
+    return drv8214_latency_used;
+}
+
+uint32_t drv8214_latency_dropped() {
+    return drv8214_latency_lost;
+}
+
+static void drv8214_latency_clear(DRV8214_LatencyHistogram& histogram) {
+    memset(histogram.buckets, 0, sizeof(histogram.buckets));
+    histogram.max_us = 0;
+    histogram.total_us = 0;
+}
+
+void drv8214_latency_reset() {
+    for (uint8_t i = 0; i < drv8214_latency_used; i++) { drv8214_latency_clear(drv8214_latency_pool[i]); }
+    drv8214_latency_lost = 0;
+}
+
+// Upper bound of the bucket holding the call of the given rank (1 = fastest), at most the maximum
+static uint32_t drv8214_latency_rank(const DRV8214_LatencyHistogram& histogram, uint32_t rank) {
+    uint32_t seen = 0;
+    for (uint8_t bucket = 0; bucket < DRV8214_LATENCY_BUCKETS; bucket++) {
+        seen += histogram.buckets[bucket];
+        if (seen >= rank) {
+            uint32_t bound = drv8214_latency_bucket_max(bucket);
+            return bound < histogram.max_us ? bound : histogram.max_us;
+        }
+    }
+    return histogram.max_us;
+}
+
+bool drv8214_latency_report(uint8_t index, DRV8214_LatencyReport& report, bool reset) {
+    if (index >= drv8214_latency_used) { return false; }
+    DRV8214_LatencyHistogram& histogram = drv8214_latency_pool[index];
+    uint32_t count = 0;
+    for (uint8_t bucket = 0; bucket < DRV8214_LATENCY_BUCKETS; bucket++) { count += histogram.buckets[bucket]; }
+    report.api       = drv8214_latency_names[histogram.api];
+    report.driver_id = histogram.driver_id;
+    report.count     = count;
+    report.mean_us   = count ? (uint32_t)(histogram.total_us / count) : 0;
+    // Nearest rank: the call below which p of the calls fall
+    report.p50_us    = count ? drv8214_latency_rank(histogram, (uint32_t)(((uint64_t)count * 500 + 999) / 1000)) : 0;
+    report.p99_us    = count ? drv8214_latency_rank(histogram, (uint32_t)(((uint64_t)count * 990 + 999) / 1000)) : 0;
+    report.p999_us   = count ? drv8214_latency_rank(histogram, (uint32_t)(((uint64_t)count * 999 + 999) / 1000)) : 0;
+    report.max_us    = histogram.max_us;
+    if (reset) { drv8214_latency_clear(histogram); }
+    return true;
+}
+
+void drv8214_latency_print(DRV8214_PrintCallback print, void* context, bool reset) {
+    char line[128];
+    snprintf(line, sizeof(line), "%-32s %3s %9s %9s %9s %9s %9s %9s\n", "api", "id", "calls", "mean_us", "p50_us", "p99_us", "p999_us", "max_us");
+    print(line, context);
+    DRV8214_LatencyReport report;
+    for (uint8_t i = 0; drv8214_latency_report(i, report, reset); i++) {
+        if (report.count == 0) { continue; }
+        snprintf(line, sizeof(line), "%-32s %3u %9lu %9lu %9lu %9lu %9lu %9lu\n", report.api, report.driver_id, (unsigned long)report.count,
+                 (unsigned long)report.mean_us, (unsigned long)report.p50_us, (unsigned long)report.p99_us, (unsigned long)report.p999_us,
+                 (unsigned long)report.max_us);
+        print(line, context);
+    }
+    if (drv8214_latency_lost) {
+        snprintf(line, sizeof(line), "%lu calls not recorded, raise DRV8214_LATENCY_HISTOGRAMS or DRV8214_LATENCY_APIS\n", (unsigned long)drv8214_latency_lost);
+        print(line, context);
+    }
+    if (reset) { drv8214_latency_lost = 0; }
+}
+
+#endif // DRV8214_LATENCY
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+#include "drv8214_log.h"
+#include <stdio.h>
+
+#define DRV8214_LOG_FORMAT_ENTRY(name, format) format,
+static const char* const drv8214_log_formats[DRV8214_EV_COUNT] = {
+    DRV8214_LOG_EVENTS(DRV8214_LOG_FORMAT_ENTRY)
+};
+#undef DRV8214_LOG_FORMAT_ENTRY
+
+// Single producer (driver calls) / single consumer (drain) ring
+static DRV8214_LogRecord drv_log_ring[DRV8214_LOG_RING_SIZE];
+static volatile uint16_t drv_log_head = 0;     // Next slot written
+static volatile uint16_t drv_log_tail = 0;     // Next slot read
+static volatile uint32_t drv_log_dropped = 0;  // Records lost because the ring was full
+
+void drv8214_log_push(uint32_t timestamp_us, uint8_t driver_id, uint8_t event, const uint32_t* args, uint8_t argc) {
+    uint16_t head = drv_log_head;
+    if ((uint16_t)(head - drv_log_tail) >= DRV8214_LOG_RING_SIZE) {
+        drv_log_dropped = drv_log_dropped + 1; // Keep the oldest records, they explain how we got here
+        return;
+    }
+    DRV8214_LogRecord& record = drv_log_ring[head & (DRV8214_LOG_RING_SIZE - 1)];
+    record.timestamp_us = timestamp_us;
+    record.event = event;
+    record.driver_id = driver_id;
+    record.argc = (argc > DRV8214_LOG_MAX_ARGS) ? DRV8214_LOG_MAX_ARGS : argc;
+    record.reserved = 0;
+    for (uint8_t i = 0; i < DRV8214_LOG_MAX_ARGS; i++) {
+        record.args[i] = (i < record.argc) ? args[i] : 0;
+    }
+    drv_log_head = head + 1;
+}
+
+uint16_t drv8214_log_drain(DRV8214_LogRecord* records, uint16_t max_records) {
+    uint16_t count = 0;
+    while (count < max_records && drv_log_tail != drv_log_head) {
+        records[count++] = drv_log_ring[drv_log_tail & (DRV8214_LOG_RING_SIZE - 1)];
+        drv_log_tail = drv_log_tail + 1;
+    }
+    return count;
+}
+
+uint32_t drv8214_log_dropped() {
+    return drv_log_dropped;
+}
+
+const char* drv8214_log_format(uint8_t event) {
+    if (event >= DRV8214_EV_COUNT) { return "Unknown event\n"; }
+    return drv8214_log_formats[event];
+}
+
+size_t drv8214_log_decode(const DRV8214_LogRecord& record, char* buffer, size_t length) {
+    // Walks the format string, formatting one conversion at a time with the matching raw argument
+    const char* fmt = drv8214_log_format(record.event);
+    size_t out = 0;
+    uint8_t arg = 0;
+    char spec[16];
+
+    if (length == 0) { return 0; }
+    buffer[0] = '\0';
+
+    while (*fmt && out + 1 < length) {
+        if (*fmt != '%') {
+            buffer[out++] = *fmt++;
+            continue;
+        }
+        if (fmt[1] == '%') {
+            buffer[out++] = '%';
+            fmt += 2;
+            continue;
+        }
+
+        // Copy the conversion specification, dropping length modifiers (arguments are always 32-bit)
+        size_t n = 0;
+        spec[n++] = *fmt++;
+        while (*fmt && strchr("-+ #0123456789.", *fmt) && n < sizeof(spec) - 2) { spec[n++] = *fmt++; }
+        while (*fmt && strchr("hlLqjzt", *fmt)) { fmt++; }
+        char conversion = *fmt ? *fmt++ : 'd';
+        spec[n++] = conversion;
+        spec[n] = '\0';
+
+        uint32_t raw = (arg < record.argc) ? record.args[arg] : 0;
+        arg++;
+        int written;
+        if (strchr("fFeEgGaA", conversion)) {
+            float value;
+            memcpy(&value, &raw, sizeof(value));
+            written = snprintf(buffer + out, length - out, spec, (double)value);
+        } else if (conversion == 'd' || conversion == 'i') {
+            written = snprintf(buffer + out, length - out, spec, (int)(int32_t)raw);
+        } else {
+            written = snprintf(buffer + out, length - out, spec, (unsigned int)raw);
+        }
+        if (written < 0) { break; }
+        out += (size_t)written;
+        if (out >= length) { out = length - 1; }
+    }
+    buffer[out] = '\0';
+    return out;
+}
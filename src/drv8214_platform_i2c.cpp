@@ -7,75 +7,287 @@
  */
 
 #include "drv8214_platform_i2c.h"
+#include "drv8214_bus.h" // The platform specific transfers live in the native bus policy
+#include "drv8214_platform_time.h"
+
+typedef DRV8214_RegisterAccess<DRV8214_NativeBus> NativeAccess;
+
+uint16_t drv8214_i2c_timeout_ms = 10;   // Per attempt timeout
+uint8_t  drv8214_i2c_retries = 2;       // Attempts repeated after a failure
+DRV8214_I2CStats drv8214_i2c_stats = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+volatile bool drv8214_i2c_recovery_pending = false;
+static DRV8214_BusRecoveryHooks drv8214_i2c_recovery_hooks;
 
 #ifdef DRV8214_PLATFORM_STM32
-    static I2C_HandleTypeDef* drv_i2c_handle = NULL; // Static pointer to the I2C handle
+    I2C_HandleTypeDef* drv8214_i2c_handle = NULL; // Pointer to the I2C handle
 
     void drv8214_i2c_set_handle(I2C_HandleTypeDef* hi2c) {
-        drv_i2c_handle = hi2c;
+        drv8214_i2c_handle = hi2c;
     }
 #endif
 
-void drv8214_i2c_write_register(uint8_t device_address, uint8_t reg, uint8_t value) {
-    if (drv_i2c_handle == NULL) {
-        // Handle error: I2C handle not set
-        return;
+#ifdef DRV8214_PLATFORM_LINUX
+    #include <fcntl.h>
+    #include <unistd.h>
+
+    int drv8214_i2c_fd = -1; // File descriptor of the i2c-dev adapter
+    static char drv8214_i2c_device[64] = ""; // Adapter path, reopened by the bus recovery
+
+    static void drv8214_i2c_apply_timeout() {
+        if (drv8214_i2c_fd < 0) { return; }
+        ioctl(drv8214_i2c_fd, I2C_TIMEOUT, (drv8214_i2c_timeout_ms + 9) / 10); // In units of 10 ms
+        ioctl(drv8214_i2c_fd, I2C_RETRIES, 0); // Retries are handled by DRV8214_RegisterAccess
+    }
+
+    bool drv8214_i2c_open(const char* device) {
+        int fd = open(device, O_RDWR);
+        if (fd < 0) { return false; }
+        if (drv8214_i2c_fd >= 0) { close(drv8214_i2c_fd); }
+        drv8214_i2c_fd = fd;
+        if (device != drv8214_i2c_device) { snprintf(drv8214_i2c_device, sizeof(drv8214_i2c_device), "%s", device); }
+        drv8214_i2c_apply_timeout();
+        return true;
+    }
+
+    void drv8214_i2c_set_fd(int fd) {
+        drv8214_i2c_fd = fd;
+        drv8214_i2c_apply_timeout();
     }
-#ifdef DRV8214_PLATFORM_ARDUINO
-    Wire.beginTransmission(device_address);
-    Wire.write(reg);
-    Wire.write(value);
-    Wire.endTransmission();
-#elif defined(DRV8214_PLATFORM_STM32)
-    uint8_t data[2] = { reg, value };
-    // STM32 HAL expects the 7-bit address to be shifted left by 1
-    HAL_I2C_Master_Transmit(drv_i2c_handle, (uint16_t)(device_address << 1), data, 2, HAL_MAX_DELAY);
-    // Add error handling for HAL_StatusTypeDef if needed
 #endif
+
+void drv8214_i2c_set_timeout(uint16_t timeout_ms) {
+    drv8214_i2c_timeout_ms = timeout_ms;
+    #if defined(DRV8214_PLATFORM_ARDUINO) && defined(WIRE_HAS_TIMEOUT)
+        Wire.setWireTimeout((uint32_t)timeout_ms * 1000, true); // AVR and megaAVR cores
+    #elif defined(DRV8214_PLATFORM_ARDUINO) && defined(ESP32)
+        Wire.setTimeOut(timeout_ms);
+    #elif defined(DRV8214_PLATFORM_LINUX)
+        drv8214_i2c_apply_timeout();
+    #endif
+    // STM32: passed to each HAL call
+}
+
+void drv8214_i2c_set_retries(uint8_t retries) {
+    drv8214_i2c_retries = retries;
+}
+
+void drv8214_i2c_get_stats(DRV8214_I2CStats& stats) {
+    stats = drv8214_i2c_stats;
+}
+
+void drv8214_i2c_reset_stats() {
+    memset(&drv8214_i2c_stats, 0, sizeof(drv8214_i2c_stats));
+}
+
+// --- Transaction Trace ---
+
+#if DRV8214_I2C_TRACE
+
+static_assert((DRV8214_I2C_TRACE_RING_SIZE & (DRV8214_I2C_TRACE_RING_SIZE - 1)) == 0, "DRV8214_I2C_TRACE_RING_SIZE must be a power of two");
+static_assert(DRV8214_I2C_TRACE_MAX_DATA >= DRV8214_BUS_MAX_BURST, "A trace record must hold the longest burst");
+
+static const uint8_t drv8214_i2c_trace_magic[4] = { 'D', '8', 'I', 'T' };
+
+// Single producer (register accesses) / single consumer (drain) byte ring of serialized records
+bool drv8214_i2c_trace_enabled = false;
+static uint8_t  drv8214_i2c_trace_ring[DRV8214_I2C_TRACE_RING_SIZE];
+static volatile uint32_t drv8214_i2c_trace_head = 0;    // Next byte written
+static volatile uint32_t drv8214_i2c_trace_tail = 0;    // Next byte read
+static volatile uint32_t drv8214_i2c_trace_lost = 0;    // Records lost because the ring was full
+static uint32_t (*drv8214_i2c_trace_clock)() = drv8214_time_micros;
+
+void drv8214_i2c_trace_start(uint32_t (*clock)()) {
+    drv8214_i2c_trace_clock = clock ? clock : drv8214_time_micros;
+    drv8214_i2c_trace_enabled = true;
+}
+
+void drv8214_i2c_trace_stop() {
+    drv8214_i2c_trace_enabled = false;
+}
+
+// Copies into or out of the ring in at most two pieces, around the wrap
+static void drv8214_i2c_trace_put(uint32_t position, const uint8_t* data, uint32_t length) {
+    uint32_t index = position & (DRV8214_I2C_TRACE_RING_SIZE - 1);
+    uint32_t first = (length < DRV8214_I2C_TRACE_RING_SIZE - index) ? length : DRV8214_I2C_TRACE_RING_SIZE - index;
+    memcpy(drv8214_i2c_trace_ring + index, data, first);
+    memcpy(drv8214_i2c_trace_ring, data + first, length - first);
 }
 
-uint8_t drv8214_i2c_read_register(uint8_t device_address, uint8_t reg) {
-    if (drv_i2c_handle == NULL) {
-         // Handle error: I2C handle not set
-        return 0;
+static void drv8214_i2c_trace_get(uint32_t position, uint8_t* data, uint32_t length) {
+    uint32_t index = position & (DRV8214_I2C_TRACE_RING_SIZE - 1);
+    uint32_t first = (length < DRV8214_I2C_TRACE_RING_SIZE - index) ? length : DRV8214_I2C_TRACE_RING_SIZE - index;
+    memcpy(data, drv8214_i2c_trace_ring + index, first);
+    memcpy(data + first, drv8214_i2c_trace_ring, length - first);
+}
+
+void drv8214_i2c_trace_record(uint8_t address, uint8_t reg, bool read, const uint8_t* data, uint8_t length, uint8_t result, uint8_t retries) {
+    if (length > DRV8214_I2C_TRACE_MAX_DATA) { length = DRV8214_I2C_TRACE_MAX_DATA; }
+    uint32_t head = drv8214_i2c_trace_head;
+    uint32_t bytes = DRV8214_I2C_TRACE_RECORD_BYTES + length;
+    if (DRV8214_I2C_TRACE_RING_SIZE - (head - drv8214_i2c_trace_tail) < bytes) {
+        drv8214_i2c_trace_lost = drv8214_i2c_trace_lost + 1; // Keep the oldest records, like the log ring
+        return;
     }
-#ifdef DRV8214_PLATFORM_ARDUINO
-    Wire.beginTransmission(device_address);
-    Wire.write(reg);
-    Wire.endTransmission(false); // Send restart condition
-    Wire.requestFrom(device_address, (uint8_t)1);
-    if (Wire.available()) {
-        return Wire.read();
+    uint32_t timestamp = drv8214_i2c_trace_clock();
+    uint8_t record[DRV8214_I2C_TRACE_RECORD_BYTES + DRV8214_I2C_TRACE_MAX_DATA] = {
+        (uint8_t)timestamp, (uint8_t)(timestamp >> 8), (uint8_t)(timestamp >> 16), (uint8_t)(timestamp >> 24), address, reg,
+        (uint8_t)((read ? DRV8214_I2C_TRACE_READ : 0) | ((result << 1) & DRV8214_I2C_TRACE_RESULT) | ((retries > DRV8214_I2C_TRACE_RETRIES_SATURATED ? DRV8214_I2C_TRACE_RETRIES_SATURATED : retries) << 3)), length
+    };
+    memcpy(record + DRV8214_I2C_TRACE_RECORD_BYTES, data, length);
+    drv8214_i2c_trace_put(head, record, bytes);
+    drv8214_i2c_trace_head = head + bytes;
+}
+
+uint32_t drv8214_i2c_trace_drain(uint8_t* out, uint32_t max_bytes) {
+    uint32_t copied = 0;
+    uint32_t tail = drv8214_i2c_trace_tail;
+    while (tail != drv8214_i2c_trace_head) {
+        uint32_t bytes = DRV8214_I2C_TRACE_RECORD_BYTES + drv8214_i2c_trace_ring[(tail + DRV8214_I2C_TRACE_RECORD_BYTES - 1) & (DRV8214_I2C_TRACE_RING_SIZE - 1)]; // Length byte
+        if (copied + bytes > max_bytes) { break; }
+        drv8214_i2c_trace_get(tail, out + copied, bytes);
+        copied += bytes;
+        tail += bytes;
+        drv8214_i2c_trace_tail = tail;
     }
-    return 0; // Error or no data
-#elif defined(DRV8214_PLATFORM_STM32)
-    uint8_t data = 0;
-    // STM32 HAL I2C typically uses separate Transmit then Receive for this,
-    // or HAL_I2C_Mem_Read for register-based reads.
-    // Your Arduino code pattern translates better to separate Transmit/Receive.
-    if (HAL_I2C_Master_Transmit(drv_i2c_handle, (uint16_t)(device_address << 1), &reg, 1, HAL_MAX_DELAY) == HAL_OK) {
-        if (HAL_I2C_Master_Receive(drv_i2c_handle, (uint16_t)(device_address << 1), &data, 1, HAL_MAX_DELAY) == HAL_OK) {
-            return data;
-        }
+    return copied;
+}
+
+uint32_t drv8214_i2c_trace_dropped() {
+    return drv8214_i2c_trace_lost;
+}
+
+uint8_t drv8214_i2c_trace_header(uint8_t* out) {
+    memcpy(out, drv8214_i2c_trace_magic, sizeof(drv8214_i2c_trace_magic));
+    out[4] = DRV8214_I2C_TRACE_VERSION;
+    return DRV8214_I2C_TRACE_HEADER_BYTES;
+}
+
+bool drv8214_i2c_trace_check_header(const uint8_t* data, size_t length) {
+    return length >= DRV8214_I2C_TRACE_HEADER_BYTES && memcmp(data, drv8214_i2c_trace_magic, sizeof(drv8214_i2c_trace_magic)) == 0 &&
+           data[4] == DRV8214_I2C_TRACE_VERSION;
+}
+
+size_t drv8214_i2c_trace_parse(const uint8_t* data, size_t length, DRV8214_I2CTraceRecord& record) {
+    if (length < DRV8214_I2C_TRACE_RECORD_BYTES) { return 0; }
+    size_t bytes = DRV8214_I2C_TRACE_RECORD_BYTES + data[7];
+    if (data[7] > DRV8214_I2C_TRACE_MAX_DATA || bytes > length) { return 0; }
+    record.timestamp_us = data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+    record.address = data[4];
+    record.reg = data[5];
+    record.flags = data[6];
+    record.length = data[7];
+    memcpy(record.data, data + DRV8214_I2C_TRACE_RECORD_BYTES, record.length);
+    return bytes;
+}
+
+#endif // DRV8214_I2C_TRACE
+
+// --- Bus Recovery ---
+
+#if defined(DRV8214_PLATFORM_ARDUINO) && defined(SDA) && defined(SCL)
+    static void drv8214_i2c_default_set_scl(bool level) {
+        if (level) { pinMode(SCL, INPUT_PULLUP); } else { pinMode(SCL, OUTPUT); digitalWrite(SCL, LOW); }
     }
-    // Consider using HAL_I2C_Mem_Read for more robustness:
-    // HAL_I2C_Mem_Read(drv_i2c_handle, (uint16_t)(device_address << 1), reg, I2C_MEMADD_SIZE_8BIT, &data, 1, HAL_MAX_DELAY);
-    return 0; // Error
+    static void drv8214_i2c_default_set_sda(bool level) {
+        if (level) { pinMode(SDA, INPUT_PULLUP); } else { pinMode(SDA, OUTPUT); digitalWrite(SDA, LOW); }
+    }
+    static bool drv8214_i2c_default_read_sda() {
+        return digitalRead(SDA) == HIGH;
+    }
+#else
+    #define drv8214_i2c_default_set_scl  nullptr
+    #define drv8214_i2c_default_set_sda  nullptr
+    #define drv8214_i2c_default_read_sda nullptr
 #endif
+
+static void drv8214_i2c_default_reinit() {
+    #if defined(DRV8214_PLATFORM_ARDUINO)
+        Wire.begin();
+    #elif defined(DRV8214_PLATFORM_STM32)
+        if (drv8214_i2c_handle != NULL) {
+            HAL_I2C_DeInit(drv8214_i2c_handle);
+            HAL_I2C_Init(drv8214_i2c_handle);
+        }
+    #elif defined(DRV8214_PLATFORM_LINUX)
+        if (drv8214_i2c_device[0] != '\0') { drv8214_i2c_open(drv8214_i2c_device); }
+    #endif
 }
 
-void drv8214_i2c_modify_register(uint8_t device_address, uint8_t reg, uint8_t mask, uint8_t enable_bits) {
-    uint8_t current_value = drv8214_i2c_read_register(device_address, reg);
-    if (enable_bits) {
-        current_value |= mask;  // Set bits
-    } else {
-        current_value &= ~mask; // Clear bits
+static void drv8214_i2c_half_clock() {
+    uint32_t start = drv8214_time_micros();
+    while (drv8214_time_micros() - start < 5) { } // 100 kHz
+}
+
+void drv8214_i2c_set_recovery_hooks(const DRV8214_BusRecoveryHooks& hooks) {
+    drv8214_i2c_recovery_hooks = hooks;
+}
+
+uint8_t drv8214_i2c_recover_bus() {
+    DRV8214_TIMELINE_SCOPE(span, "recover_bus", DRV8214_TIMELINE_BUS_TRACK, 0);
+    void (*set_scl)(bool) = drv8214_i2c_recovery_hooks.set_scl ? drv8214_i2c_recovery_hooks.set_scl : drv8214_i2c_default_set_scl;
+    void (*set_sda)(bool) = drv8214_i2c_recovery_hooks.set_sda ? drv8214_i2c_recovery_hooks.set_sda : drv8214_i2c_default_set_sda;
+    bool (*read_sda)() = drv8214_i2c_recovery_hooks.read_sda ? drv8214_i2c_recovery_hooks.read_sda : drv8214_i2c_default_read_sda;
+    void (*reinit)() = drv8214_i2c_recovery_hooks.reinit ? drv8214_i2c_recovery_hooks.reinit : drv8214_i2c_default_reinit;
+    drv8214_i2c_stats.recoveries++;
+
+    bool released = true;
+    if (set_scl && set_sda && read_sda) {
+        #ifdef DRV8214_PLATFORM_ARDUINO
+            Wire.end(); // Take the pins away from the peripheral
+        #endif
+        // A slave interrupted in the middle of a read holds SDA low until it has shifted out its byte:
+        // clock SCL until SDA is released, at most 9 clocks, then generate a STOP condition
+        set_sda(true);
+        for (uint8_t clock = 0; clock < 9 && !read_sda(); clock++) {
+            set_scl(false);
+            drv8214_i2c_half_clock();
+            set_scl(true);
+            drv8214_i2c_half_clock();
+        }
+        released = read_sda();
+        set_scl(false);
+        drv8214_i2c_half_clock();
+        set_sda(false);
+        drv8214_i2c_half_clock();
+        set_scl(true);
+        drv8214_i2c_half_clock();
+        set_sda(true); // SDA rising while SCL is high: STOP
+        drv8214_i2c_half_clock();
     }
-    drv8214_i2c_write_register(device_address, reg, current_value);
+    reinit();
+
+    drv8214_i2c_recovery_pending = !released;
+    return released ? DRV8214_I2C_OK : DRV8214_I2C_ERROR;
 }
 
-void drv8214_i2c_modify_register_bits(uint8_t device_address, uint8_t reg, uint8_t mask, uint8_t new_value) {
-    uint8_t current_value = drv8214_i2c_read_register(device_address, reg);
-    current_value = (current_value & ~mask) | (new_value & mask); // Apply new value only to masked bits
-    drv8214_i2c_write_register(device_address, reg, current_value);
-}
\ No newline at end of file
+uint8_t drv8214_i2c_write_register(uint8_t device_address, uint8_t reg, uint8_t value) {
+    return NativeAccess::write(device_address, reg, value);
+}
+
+uint8_t drv8214_i2c_read_register(uint8_t device_address, uint8_t reg, uint8_t* value) {
+    return NativeAccess::read(device_address, reg, value); // 0 on error
+}
+
+uint8_t drv8214_i2c_write_registers(uint8_t device_address, uint8_t reg, const uint8_t* data, uint8_t length) {
+    return NativeAccess::writeBurst(device_address, reg, data, length);
+}
+
+uint8_t drv8214_i2c_read_registers(uint8_t device_address, uint8_t reg, uint8_t* data, uint8_t length) {
+    return NativeAccess::readBurst(device_address, reg, data, length);
+}
+
+uint8_t drv8214_i2c_modify_register(uint8_t device_address, uint8_t reg, uint8_t mask, uint8_t enable_bits) {
+    return NativeAccess::modify(device_address, reg, mask, enable_bits);
+}
+
+uint8_t drv8214_i2c_modify_register_bits(uint8_t device_address, uint8_t reg, uint8_t mask, uint8_t new_value) {
+    return NativeAccess::modifyBits(device_address, reg, mask, new_value);
+}
+
+uint8_t drv8214_i2c_try_write_registers(uint8_t device_address, uint8_t reg, const uint8_t* data, uint8_t length) {
+    return DRV8214_NativeBus::write(device_address, reg, data, length);
+}
+
+uint8_t drv8214_i2c_try_read_registers(uint8_t device_address, uint8_t reg, uint8_t* data, uint8_t length) {
+    return DRV8214_NativeBus::read(device_address, reg, data, length);
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+#include "drv8214_platform_time.h"
+
+#ifdef DRV8214_PLATFORM_LINUX
+    #include <time.h>
+
+    static uint64_t drv8214_time_now_us() {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint64_t)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+    }
+#endif
+
+uint32_t drv8214_time_millis() {
+#ifdef DRV8214_PLATFORM_ARDUINO
+    return millis();
+#elif defined(DRV8214_PLATFORM_STM32)
+    return HAL_GetTick();
+#elif defined(DRV8214_PLATFORM_LINUX)
+    return (uint32_t)(drv8214_time_now_us() / 1000);
+#endif
+}
+
+uint32_t drv8214_time_micros() {
+#ifdef DRV8214_PLATFORM_ARDUINO
+    return micros();
+#elif defined(DRV8214_PLATFORM_STM32)
+    // HAL tick (1 ms) refined with the SysTick down-counter. tick * 1000 wraps at 2^32 µs, like Arduino micros().
+    uint32_t tick = HAL_GetTick();
+    uint32_t load = SysTick->LOAD;
+    uint32_t elapsed = load - SysTick->VAL;
+    if (HAL_GetTick() != tick) { // SysTick reloaded while reading, take the new tick with no sub-ms part
+        return HAL_GetTick() * 1000U;
+    }
+    return tick * 1000U + (elapsed * 1000U) / (load + 1U);
+#elif defined(DRV8214_PLATFORM_LINUX)
+    return (uint32_t)drv8214_time_now_us();
+#endif
+}
+
+void drv8214_time_delay_ms(uint32_t ms) {
+#ifdef DRV8214_PLATFORM_ARDUINO
+    delay(ms);
+#elif defined(DRV8214_PLATFORM_STM32)
+    HAL_Delay(ms);
+#elif defined(DRV8214_PLATFORM_LINUX)
+    struct timespec ts = { (time_t)(ms / 1000), (long)(ms % 1000) * 1000000L };
+    nanosleep(&ts, NULL);
+#endif
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+#include "drv8214_regmap.h"
+#include <stdio.h>
+
+// --- Lookup ---
+
+const DRV8214_RegisterDesc* drv8214_regmap_register(uint8_t address) {
+    for (const DRV8214_RegisterDesc& reg : DRV8214_REGISTER_TABLE) {
+        if (reg.address == address) { return &reg; }
+    }
+    return nullptr;
+}
+
+const DRV8214_FieldDesc* drv8214_regmap_field(uint8_t address, uint8_t mask) {
+    for (const DRV8214_FieldDesc& field : DRV8214_FIELD_TABLE) {
+        if (field.reg == address && field.mask == mask) { return &field; }
+    }
+    return nullptr;
+}
+
+// --- Services ---
+
+uint8_t drv8214_regmap_diff(const uint8_t* actual, const uint8_t* expected, DRV8214_FieldDiff* diffs, uint8_t max_diffs) {
+    uint8_t count = 0;
+    for (const DRV8214_RegisterDesc& reg : DRV8214_REGISTER_TABLE) {
+        if (reg.access != DRV8214_RW) { continue; }
+        uint8_t changed = actual[reg.address] ^ expected[reg.address];
+        if (changed == 0) { continue; }
+        // Named fields first, then the bits no field covers (whole-byte registers)
+        uint8_t unnamed = 0xFF;
+        for (const DRV8214_FieldDesc& field : DRV8214_FIELD_TABLE) {
+            if (field.reg != reg.address) { continue; }
+            unnamed &= ~field.mask;
+            if (!(changed & field.mask)) { continue; }
+            if (count < max_diffs) { diffs[count] = { reg.address, field.mask, (uint8_t)(expected[reg.address] & field.mask), (uint8_t)(actual[reg.address] & field.mask) }; }
+            count++;
+        }
+        if (changed & unnamed) {
+            if (count < max_diffs) { diffs[count] = { reg.address, unnamed, (uint8_t)(expected[reg.address] & unnamed), (uint8_t)(actual[reg.address] & unnamed) }; }
+            count++;
+        }
+    }
+    return count;
+}
+
+uint8_t drv8214_regmap_validate(const uint8_t* image) {
+    uint8_t checks = 0;
+    for (const DRV8214_RegisterDesc& reg : DRV8214_REGISTER_TABLE) {
+        if (reg.access == DRV8214_RW && (image[reg.address] & reg.reserved)) { checks |= DRV8214_CHECK_RESERVED; }
+    }
+    bool ripple_counting = FIELD_RC_CTRL0_EN_RC::decode(image[DRV8214_RC_CTRL0]);
+    if (ripple_counting && image[DRV8214_RC_CTRL3] == 0) { checks |= DRV8214_CHECK_INV_R; }
+    if (ripple_counting && image[DRV8214_RC_CTRL4] == 0) { checks |= DRV8214_CHECK_KMC; }
+    if (FIELD_REG_CTRL0_REG_CTRL::decode(image[DRV8214_REG_CTRL0]) == 0b10 && !ripple_counting) { checks |= DRV8214_CHECK_SPEED_RC; }
+    uint16_t threshold = (FIELD_RC_CTRL2_RC_THR_HIGH::decode(image[DRV8214_RC_CTRL2]) << 8) | image[DRV8214_RC_CTRL1];
+    if (FIELD_RC_CTRL0_RC_HIZ::decode(image[DRV8214_RC_CTRL0]) && threshold == 0) { checks |= DRV8214_CHECK_THRESHOLD; }
+    return checks;
+}
+
+// --- Text Output ---
+
+// Field value aligned on bit 0
+static uint8_t drv_regmap_value(uint8_t bits, uint8_t mask) {
+    return (uint8_t)((bits & mask) >> drv8214_mask_shift(mask));
+}
+
+void drv8214_regmap_print_dump(const uint8_t* image, DRV8214_PrintCallback print, void* context) {
+    char line[160];
+    for (const DRV8214_RegisterDesc& reg : DRV8214_REGISTER_TABLE) {
+        int length = snprintf(line, sizeof(line), "0x%02X %-11s %s 0x%02X", reg.address, reg.name, reg.access == DRV8214_RW ? "RW" : "RO", image[reg.address]);
+        for (const DRV8214_FieldDesc& field : DRV8214_FIELD_TABLE) {
+            if (field.reg != reg.address || length >= (int)sizeof(line)) { continue; }
+            length += snprintf(line + length, sizeof(line) - length, " %s=%u", field.name, drv_regmap_value(image[reg.address], field.mask));
+        }
+        if (length < (int)sizeof(line) - 1) { line[length++] = '\n'; line[length] = '\0'; }
+        print(line, context);
+    }
+}
+
+void drv8214_regmap_print_diff(const DRV8214_FieldDiff* diffs, uint8_t count, DRV8214_PrintCallback print, void* context) {
+    char line[96];
+    for (uint8_t i = 0; i < count; i++) {
+        const DRV8214_RegisterDesc* reg = drv8214_regmap_register(diffs[i].reg);
+        const DRV8214_FieldDesc* field = drv8214_regmap_field(diffs[i].reg, diffs[i].mask);
+        if (field) {
+            snprintf(line, sizeof(line), "%s.%s: expected %u, read %u\n", reg ? reg->name : "?", field->name,
+                     drv_regmap_value(diffs[i].expected, diffs[i].mask), drv_regmap_value(diffs[i].actual, diffs[i].mask));
+        } else {
+            snprintf(line, sizeof(line), "%s[0x%02X]: expected 0x%02X, read 0x%02X\n", reg ? reg->name : "?", diffs[i].mask, diffs[i].expected, diffs[i].actual);
+        }
+        print(line, context);
+    }
+}
+
+void drv8214_regmap_print_checks(uint8_t checks, DRV8214_PrintCallback print, void* context) {
+    static const char* const messages[] = {
+        "Reserved bits set\n",
+        "Ripple counting enabled with INV_R = 0\n",
+        "Ripple counting enabled with KMC = 0\n",
+        "Speed regulation without ripple counting\n",
+        "Outputs released at a ripple threshold of 0\n"
+    };
+    for (uint8_t i = 0; i < sizeof(messages) / sizeof(messages[0]); i++) {
+        if (checks & (1 << i)) { print(messages[i], context); }
+    }
+}
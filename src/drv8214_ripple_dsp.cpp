@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+#include "drv8214_ripple_dsp.h"
+#include <math.h>
+
+#ifndef M_PI
+    #define M_PI 3.14159265358979323846
+#endif
+
+// Butterworth (Q = 1/sqrt(2)) low-pass or high-pass section, coefficients from the RBJ audio EQ cookbook
+static DRV8214_Biquad makeButterworth(float cutoff_hz, float sample_rate_hz, bool highpass) {
+    DRV8214_Biquad f;
+    float w0 = 2.0f * (float)M_PI * cutoff_hz / sample_rate_hz;
+    float cs = cosf(w0);
+    float alpha = sinf(w0) / (2.0f * 0.70710678f);
+    float a0 = 1.0f + alpha;
+
+    if (highpass) {
+        f.b0 = ((1.0f + cs) / 2.0f) / a0;
+        f.b1 = -(1.0f + cs) / a0;
+    } else {
+        f.b0 = ((1.0f - cs) / 2.0f) / a0;
+        f.b1 = (1.0f - cs) / a0;
+    }
+    f.b2 = f.b0;
+    f.a1 = (-2.0f * cs) / a0;
+    f.a2 = (1.0f - alpha) / a0;
+    f.z1 = 0.0f;
+    f.z2 = 0.0f;
+    return f;
+}
+
+static inline float runBiquad(DRV8214_Biquad& f, float x) {
+    float y = f.b0 * x + f.z1;
+    f.z1 = f.b1 * x - f.a1 * y + f.z2;
+    f.z2 = f.b2 * x - f.a2 * y;
+    return y;
+}
+
+// --- DRV8214RippleDetector ---
+
+void DRV8214RippleDetector::init(const DRV8214_RippleDetectorConfig& cfg) {
+    config = cfg;
+
+    // Keep the band-pass edges below Nyquist
+    float nyquist = config.sample_rate_hz / 2.0f;
+    if (config.high_cut_hz > 0.9f * nyquist) { config.high_cut_hz = 0.9f * nyquist; }
+    if (config.low_cut_hz >= config.high_cut_hz) { config.low_cut_hz = config.high_cut_hz / 10.0f; }
+
+    min_period_samples = (uint32_t)(config.min_ripple_period_s * config.sample_rate_hz);
+    if (min_period_samples < 2) { min_period_samples = 2; } // A peak needs at least one sample on each side
+
+    // The envelope is updated once per block, convert the time constant accordingly
+    envelope_alpha = 1.0f - expf(-(float)DRV8214_RIPPLE_BLOCK_SIZE / (config.envelope_time_s * config.sample_rate_hz));
+
+    reset();
+}
+
+void DRV8214RippleDetector::reset() {
+    highpass = makeButterworth(config.low_cut_hz, config.sample_rate_hz, true);
+    lowpass = makeButterworth(config.high_cut_hz, config.sample_rate_hz, false);
+    envelope = 0.0f;
+    samples_since_peak = min_period_samples;
+    ripple_count = 0;
+    sample_count = 0;
+    filtered[0] = 0.0f;
+    filtered[1] = 0.0f;
+}
+
+uint32_t DRV8214RippleDetector::process(const float* samples, size_t count) {
+    uint64_t start = ripple_count;
+    while (count > 0) {
+        size_t n = (count > DRV8214_RIPPLE_BLOCK_SIZE) ? DRV8214_RIPPLE_BLOCK_SIZE : count;
+        processBlock(samples, n);
+        samples += n;
+        count -= n;
+    }
+    return (uint32_t)(ripple_count - start);
+}
+
+uint32_t DRV8214RippleDetector::process(const uint8_t* current_registers, size_t count, float max_current) {
+    // REG_STATUS2: 00h corresponds to 0 A and C0h corresponds to the maximum value set by the CS_GAIN_SEL bits
+    float block[DRV8214_RIPPLE_BLOCK_SIZE];
+    const float scale = max_current / 192.0f;
+    uint64_t start = ripple_count;
+    while (count > 0) {
+        size_t n = (count > DRV8214_RIPPLE_BLOCK_SIZE) ? DRV8214_RIPPLE_BLOCK_SIZE : count;
+        for (size_t i = 0; i < n; i++) {
+            block[i] = current_registers[i] * scale;
+        }
+        processBlock(block, n);
+        current_registers += n;
+        count -= n;
+    }
+    return (uint32_t)(ripple_count - start);
+}
+
+void DRV8214RippleDetector::processBlock(const float* samples, size_t count) {
+    // filtered[0..1] hold the last two samples of the previous block, new samples start at filtered[2]
+    float* y = filtered + 2;
+
+    // Band-pass, recursive so it stays scalar: two cascaded biquads per sample
+    for (size_t i = 0; i < count; i++) {
+        y[i] = runBiquad(lowpass, runBiquad(highpass, samples[i]));
+    }
+
+    // Running RMS of the filtered signal (plain reduction, vectorisable)
+    float energy = 0.0f;
+    for (size_t i = 0; i < count; i++) {
+        energy += y[i] * y[i];
+    }
+    float rms = sqrtf(energy / (float)count);
+    if (envelope == 0.0f) {
+        envelope = rms; // First block, no history to smooth with
+    } else {
+        envelope += envelope_alpha * (rms - envelope);
+    }
+
+    float threshold = config.threshold_ratio * envelope;
+    if (threshold < config.min_peak_amplitude) { threshold = config.min_peak_amplitude; }
+
+    // Peak candidates: local maxima above threshold. Branch-free so the compiler can vectorise it.
+    // Candidate k is evaluated once its right neighbour is known, hence the one sample delay.
+    for (size_t k = 1; k <= count; k++) {
+        float v = filtered[k];
+        candidates[k - 1] = (uint8_t)((v > threshold) & (v > filtered[k - 1]) & (v >= filtered[k + 1]));
+    }
+
+    // Apply the refractory period, only this sweep is sequential
+    for (size_t i = 0; i < count; i++) {
+        samples_since_peak++;
+        if (candidates[i] && samples_since_peak >= min_period_samples) {
+            ripple_count++;
+            samples_since_peak = 0;
+        }
+    }
+
+    filtered[0] = filtered[count];
+    filtered[1] = filtered[count + 1];
+    sample_count += count;
+}
+
+// --- DRV8214RippleCrossCheck ---
+
+void DRV8214RippleCrossCheck::begin(uint16_t hw_count) {
+    last_hw_count = hw_count;
+    hw_total = 0;
+    sw_total = 0;
+}
+
+void DRV8214RippleCrossCheck::update(uint32_t sw_ripples, uint16_t hw_count) {
+    // The hardware counter is 16-bit, unsigned subtraction handles the wrap-around
+    hw_total += (uint16_t)(hw_count - last_hw_count);
+    last_hw_count = hw_count;
+    sw_total += sw_ripples;
+}
+
+void DRV8214RippleCrossCheck::resynchronize(uint16_t hw_count) {
+    // Call after the hardware counter was cleared (CLR_CNT), without accumulating the jump
+    last_hw_count = hw_count;
+}
+
+float DRV8214RippleCrossCheck::getDriftRatio() const {
+    if (sw_total == 0) { return 0.0f; }
+    return (float)getDrift() / (float)sw_total;
+}
+
+bool DRV8214RippleCrossCheck::isMiscounting() const {
+    int64_t drift = getDrift();
+    if (drift < 0) { drift = -drift; }
+    float ratio = fabsf(getDriftRatio());
+    return (drift > (int64_t)tolerance_ripples) && (ratio > tolerance_ratio);
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+#include "drv8214_shm.h"
+
+#ifdef DRV8214_PLATFORM_LINUX
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// The header and the record sequences are shared between processes, they are only accessed with the GCC atomic
+// builtins. These are lock-free, hence address-free, for 64-bit values on the 64-bit Linux targets.
+static_assert(__atomic_always_lock_free(sizeof(uint64_t), 0), "64-bit atomics must be lock-free to be shared between processes");
+
+// --- Publisher ---
+
+bool DRV8214ShmPublisher::open(const char* path, uint32_t capacity) {
+    close();
+    if (capacity < 2 || (capacity & (capacity - 1)) != 0) {
+        errno = EINVAL;
+        return false;
+    }
+
+    // A new inode, so readers still mapping a previous ring never see it shrink or restart
+    unlink(path);
+    int fd = ::open(path, O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd < 0) { return false; }
+    size_t bytes = sizeof(DRV8214_ShmHeader) + (size_t)capacity * sizeof(DRV8214_ShmRecord);
+    if (ftruncate(fd, (off_t)bytes) != 0) {
+        ::close(fd);
+        return false;
+    }
+    void* map = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd); // The mapping keeps the file open
+    if (map == MAP_FAILED) { return false; }
+
+    header = (DRV8214_ShmHeader*)map;
+    records = (DRV8214_ShmRecord*)(header + 1);
+    mapped_bytes = bytes;
+    head = 0;
+    // The file starts zeroed: every record has sequence 0, which no reader accepts
+    header->version = DRV8214_SHM_VERSION;
+    header->record_bytes = sizeof(DRV8214_ShmRecord);
+    header->capacity = capacity;
+    __atomic_store_n(&header->magic, DRV8214_SHM_MAGIC, __ATOMIC_RELEASE); // Readers check it last
+    return true;
+}
+
+void DRV8214ShmPublisher::close() {
+    if (header) { munmap(header, mapped_bytes); }
+    header = nullptr;
+    records = nullptr;
+    mapped_bytes = 0;
+}
+
+void DRV8214ShmPublisher::publish(uint8_t driver_id, const DRV8214_Status& status, int32_t position, uint32_t timestamp_us) {
+    if (!header) { return; }
+    DRV8214_ShmRecord& record = records[head & (header->capacity - 1)];
+    __atomic_store_n(&record.sequence, 2 * head + 1, __ATOMIC_RELAXED); // Odd: readers of the previous lap back off
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    record.timestamp_us = timestamp_us;
+    record.driver_id = driver_id;
+    record.status = status;
+    record.position = position;
+    __atomic_store_n(&record.sequence, 2 * head + 2, __ATOMIC_RELEASE);
+    head++;
+    __atomic_store_n(&header->head, head, __ATOMIC_RELEASE);
+}
+
+// --- Reader ---
+
+bool DRV8214ShmReader::open(const char* path, bool from_oldest) {
+    close();
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) { return false; }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || (size_t)info.st_size < sizeof(DRV8214_ShmHeader)) {
+        ::close(fd);
+        errno = EINVAL;
+        return false;
+    }
+    void* map = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED) { return false; }
+
+    const DRV8214_ShmHeader* shared = (const DRV8214_ShmHeader*)map;
+    uint32_t capacity = shared->capacity;
+    if (__atomic_load_n(&shared->magic, __ATOMIC_ACQUIRE) != DRV8214_SHM_MAGIC || shared->version != DRV8214_SHM_VERSION ||
+        shared->record_bytes != sizeof(DRV8214_ShmRecord) || capacity < 2 || (capacity & (capacity - 1)) != 0 ||
+        (size_t)info.st_size < sizeof(DRV8214_ShmHeader) + (size_t)capacity * sizeof(DRV8214_ShmRecord)) {
+        munmap(map, (size_t)info.st_size);
+        errno = EINVAL;
+        return false;
+    }
+
+    header = shared;
+    records = (const DRV8214_ShmRecord*)(header + 1);
+    mapped_bytes = (size_t)info.st_size;
+    mask = capacity - 1;
+    uint64_t published = __atomic_load_n(&header->head, __ATOMIC_ACQUIRE);
+    next = (from_oldest && published > capacity) ? published - capacity : (from_oldest ? 0 : published);
+    peeked = 0;
+    lost = 0;
+    return true;
+}
+
+void DRV8214ShmReader::close() {
+    if (header) { munmap((void*)header, mapped_bytes); }
+    header = nullptr;
+    records = nullptr;
+    mapped_bytes = 0;
+}
+
+const DRV8214_ShmRecord* DRV8214ShmReader::peek() {
+    if (!header) { return nullptr; }
+    for (;;) {
+        const DRV8214_ShmRecord& record = records[next & mask];
+        uint64_t sequence = __atomic_load_n(&record.sequence, __ATOMIC_ACQUIRE);
+        if (sequence == 2 * next + 2) {
+            peeked = sequence;
+            return &record;
+        }
+        if (sequence < 2 * next + 2) { return nullptr; } // Not published yet, or being written for the first time
+
+        // Lapped: the slot already holds a later record. Resume at the oldest record that can still be complete.
+        uint64_t published = __atomic_load_n(&header->head, __ATOMIC_ACQUIRE);
+        uint64_t resume = published - mask;
+        if (resume <= next) { resume = next + 1; }
+        lost += resume - next;
+        next = resume;
+    }
+}
+
+bool DRV8214ShmReader::consume() {
+    if (!peeked) { return false; }
+    __atomic_thread_fence(__ATOMIC_ACQUIRE); // The reads of the record happen before the second sequence read
+    bool intact = __atomic_load_n(&records[next & mask].sequence, __ATOMIC_RELAXED) == peeked;
+    peeked = 0;
+    if (!intact) { lost++; }
+    next++;
+    return intact;
+}
+
+bool DRV8214ShmReader::read(DRV8214_ShmRecord& record) {
+    while (const DRV8214_ShmRecord* shared = peek()) {
+        memcpy(&record, (const void*)shared, sizeof(record));
+        if (consume()) { return true; }
+    }
+    return false;
+}
+
+uint64_t DRV8214ShmReader::getAvailable() const {
+    if (!header) { return 0; }
+    uint64_t published = __atomic_load_n(&header->head, __ATOMIC_ACQUIRE);
+    return published > next ? published - next : 0;
+}
+
+#endif // DRV8214_PLATFORM_LINUX
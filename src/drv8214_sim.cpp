@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+#include "drv8214_sim.h"
+#include "drv8214_bus.h"
+
+static DRV8214Sim* drv8214_sim_devices[DRV8214_SIM_MAX_DEVICES] = { nullptr };
+
+DRV8214Sim::DRV8214Sim(uint8_t addr, const DRV8214_SimMotor& m) : address(addr), motor(m), position(0), real_time(false), last_access_us(0) {
+    powerOnReset();
+}
+
+void DRV8214Sim::powerOnReset() {
+    memcpy(regs, DRV8214_RESET_VALUES, sizeof(regs));
+    ripple_phase = 0.0f;
+    hiz_latched = false;
+    stall_latched = false;
+}
+
+void DRV8214Sim::setRealTime(bool enable) {
+    real_time = enable;
+    last_access_us = drv8214_time_micros();
+}
+
+void DRV8214Sim::sync() {
+    if (!real_time) { return; }
+    uint32_t now = drv8214_time_micros();
+    step(now - last_access_us);
+    last_access_us = now;
+}
+
+void DRV8214Sim::write(uint8_t reg, const uint8_t* data, uint8_t length) {
+    sync();
+    for (uint8_t i = 0; i < length; i++, reg++) {
+        if (reg < DRV8214_CONFIG0 || reg >= DRV8214_SIM_REG_COUNT) { continue; } // Read-only or reserved
+        uint8_t value = data[i];
+        if (reg == DRV8214_CONFIG0) {
+            if (value & CONFIG0_CLR_CNT) {
+                regs[DRV8214_RC_STATUS2] = 0;
+                regs[DRV8214_RC_STATUS3] = 0;
+                regs[DRV8214_FAULT] &= ~FAULT_CNT_DONE;
+                hiz_latched = false;
+            }
+            if (value & CONFIG0_CLR_FLT) {
+                regs[DRV8214_FAULT] &= ~(FAULT_FAULT | FAULT_STALL | FAULT_OCP | FAULT_OVP | FAULT_TSD | FAULT_NPOR);
+                stall_latched = false;
+            }
+            value &= ~(CONFIG0_CLR_CNT | CONFIG0_CLR_FLT); // Self-clearing bits
+        }
+        regs[reg] = value;
+    }
+}
+
+void DRV8214Sim::read(uint8_t reg, uint8_t* data, uint8_t length) {
+    sync();
+    for (uint8_t i = 0; i < length; i++, reg++) {
+        data[i] = (reg < DRV8214_SIM_REG_COUNT) ? regs[reg] : 0;
+    }
+}
+
+int8_t DRV8214Sim::driveDirection() const {
+    if (!(regs[DRV8214_CONFIG0] & CONFIG0_EN_OUT) || hiz_latched || stall_latched) { return 0; }
+    if (!(regs[DRV8214_CONFIG4] & CONFIG4_I2C_BC)) { return 0; } // Bridge controlled by the INx pins, not simulated
+    bool in1 = regs[DRV8214_CONFIG4] & CONFIG4_I2C_EN_IN1;
+    bool in2 = regs[DRV8214_CONFIG4] & CONFIG4_I2C_PH_IN2;
+    if (regs[DRV8214_CONFIG4] & CONFIG4_PMODE) {
+        // PWM mode: 10 forward, 01 reverse, 11 brake, 00 coast
+        if (in1 && !in2) { return 1; }
+        if (!in1 && in2) { return -1; }
+        return 0;
+    }
+    // PH/EN mode: EN = 0 brakes, PH selects the direction
+    if (!in1) { return 0; }
+    return in2 ? 1 : -1;
+}
+
+float DRV8214Sim::rippleRate() const {
+    static const uint8_t w_scales[4] = {16, 32, 64, 128};
+    float range = (regs[DRV8214_CONFIG0] & CONFIG0_VM_GAIN_SEL) ? 3.92f : 15.7f;
+    switch ((regs[DRV8214_REG_CTRL0] & REG_CTRL0_REG_CTRL) >> 3) {
+        case 0b10: // Speed regulation, WSET_VSET * W_SCALE in rad/s
+            return regs[DRV8214_REG_CTRL1] * w_scales[regs[DRV8214_REG_CTRL0] & REG_CTRL0_W_SCALE] / (2.0f * (float)M_PI);
+        case 0b11: // Voltage regulation
+            return (regs[DRV8214_REG_CTRL1] / 255.0f) * range * motor.ripples_per_volt;
+        default:   // Current regulation, the motor runs at its free speed
+            return motor.free_ripple_rate;
+    }
+}
+
+void DRV8214Sim::step(uint32_t dt_us) {
+    static const uint8_t  w_scales[4] = {16, 32, 64, 128};
+    static const uint16_t thr_scales[4] = {2, 8, 16, 64};
+    static const float    max_currents[8] = {4.0f, 2.0f, 1.0f, 0.5f, 0.25f, 0.125f, 0.25f, 0.125f};
+
+    int8_t direction = driveDirection();
+    float range = (regs[DRV8214_CONFIG0] & CONFIG0_VM_GAIN_SEL) ? 3.92f : 15.7f;
+    float max_current = max_currents[regs[DRV8214_RC_CTRL0] & RC_CTRL0_CS_GAIN_SEL];
+    if (direction == 0) {
+        regs[DRV8214_RC_STATUS1] = 0;
+        regs[DRV8214_REG_STATUS1] = 0;
+        regs[DRV8214_REG_STATUS2] = 0;
+        regs[DRV8214_REG_STATUS3] = 0;
+        return;
+    }
+
+    float rate = rippleRate();
+    ripple_phase += rate * dt_us * 1e-6f;
+    uint32_t ripples = (uint32_t)ripple_phase;
+    ripple_phase -= ripples;
+
+    // Hard stops
+    bool stalled = false;
+    if (direction > 0 && (int64_t)position + ripples >= motor.stop_max) {
+        ripples = (motor.stop_max > position) ? (uint32_t)(motor.stop_max - position) : 0;
+        stalled = true;
+    } else if (direction < 0 && (int64_t)position - ripples <= motor.stop_min) {
+        ripples = (position > motor.stop_min) ? (uint32_t)(position - motor.stop_min) : 0;
+        stalled = true;
+    }
+
+    // Ripple counter and threshold
+    uint16_t count = (regs[DRV8214_RC_STATUS3] << 8) | regs[DRV8214_RC_STATUS2];
+    uint32_t threshold = (((regs[DRV8214_RC_CTRL2] & RC_CTRL2_RC_THR_HIGH) << 8) | regs[DRV8214_RC_CTRL1]) * thr_scales[(regs[DRV8214_RC_CTRL2] & RC_CTRL2_RC_THR_SCALE) >> 2];
+    if ((regs[DRV8214_RC_CTRL0] & RC_CTRL0_EN_RC) && threshold > 0 && count < threshold && count + ripples >= threshold) {
+        regs[DRV8214_FAULT] |= FAULT_CNT_DONE;
+        if (regs[DRV8214_RC_CTRL0] & RC_CTRL0_RC_HIZ) {
+            ripples = threshold - count; // The bridge is released exactly at the threshold
+            hiz_latched = true;
+        }
+    }
+    position += direction * (int32_t)ripples;
+    if (regs[DRV8214_RC_CTRL0] & RC_CTRL0_EN_RC) {
+        count += ripples;
+        regs[DRV8214_RC_STATUS2] = count & 0xFF;
+        regs[DRV8214_RC_STATUS3] = count >> 8;
+    }
+
+    if (stalled && (regs[DRV8214_CONFIG0] & CONFIG0_EN_STALL)) {
+        regs[DRV8214_FAULT] |= FAULT_STALL | FAULT_FAULT;
+        if (!(regs[DRV8214_CONFIG3] & CONFIG3_SMODE)) { stall_latched = true; }
+    }
+
+    // Status registers
+    float speed = stalled ? 0.0f : rate * 2.0f * (float)M_PI / w_scales[regs[DRV8214_REG_CTRL0] & REG_CTRL0_W_SCALE];
+    float current = stalled ? motor.stall_current : motor.running_current;
+    if (current > max_current) { current = max_current; }
+    regs[DRV8214_RC_STATUS1] = speed > 255.0f ? 255 : (uint8_t)speed;
+    regs[DRV8214_REG_STATUS1] = motor.supply_voltage >= range ? 255 : (uint8_t)(motor.supply_voltage / range * 255.0f);
+    regs[DRV8214_REG_STATUS2] = (uint8_t)(current / max_current * 192.0f);
+    float duty = rate / motor.free_ripple_rate;
+    regs[DRV8214_REG_STATUS3] = duty >= 1.0f ? REG_STATUS3_IN_DUTY : (uint8_t)(duty * REG_STATUS3_IN_DUTY);
+}
+
+// --- Registry ---
+
+bool drv8214_sim_attach(DRV8214Sim* device) {
+    for (uint8_t i = 0; i < DRV8214_SIM_MAX_DEVICES; i++) {
+        if (drv8214_sim_devices[i] == nullptr) {
+            drv8214_sim_devices[i] = device;
+            return true;
+        }
+    }
+    return false;
+}
+
+void drv8214_sim_detach(DRV8214Sim* device) {
+    for (uint8_t i = 0; i < DRV8214_SIM_MAX_DEVICES; i++) {
+        if (drv8214_sim_devices[i] == device) { drv8214_sim_devices[i] = nullptr; }
+    }
+}
+
+DRV8214Sim* drv8214_sim_find(uint8_t address) {
+    for (uint8_t i = 0; i < DRV8214_SIM_MAX_DEVICES; i++) {
+        if (drv8214_sim_devices[i] && drv8214_sim_devices[i]->getAddress() == address) { return drv8214_sim_devices[i]; }
+    }
+    return nullptr;
+}
+
+// --- DRV8214_SimBus ---
+
+static DRV8214_SimBusFaults drv_sim_faults;
+static uint32_t drv_sim_rng = 1;
+static uint64_t drv_sim_bus_time_us = 0;
+static uint8_t  drv_sim_stuck_clocks = 0;  // SCL clocks the stuck device still needs before releasing SDA
+static bool     drv_sim_scl = true;        // Level of the simulated SCL line
+
+void drv8214_sim_bus_set_faults(const DRV8214_SimBusFaults& faults) {
+    drv_sim_faults = faults;
+    drv_sim_rng = faults.seed ? faults.seed : 1; // xorshift32 state must not be 0
+}
+
+uint64_t drv8214_sim_bus_time_us() {
+    return drv_sim_bus_time_us;
+}
+
+void drv8214_sim_bus_reset_time() {
+    drv_sim_bus_time_us = 0;
+}
+
+void drv8214_sim_bus_stick(uint8_t clocks_to_release) {
+    drv_sim_stuck_clocks = clocks_to_release > 9 ? 9 : clocks_to_release;
+}
+
+bool drv8214_sim_bus_stuck() {
+    return drv_sim_stuck_clocks > 0;
+}
+
+static void drv_sim_set_scl(bool level) {
+    if (level && !drv_sim_scl && drv_sim_stuck_clocks > 0) { drv_sim_stuck_clocks--; } // The device shifts out one bit per clock
+    drv_sim_scl = level;
+    drv_sim_bus_time_us += 5; // Half period at 100 kHz
+}
+
+static void drv_sim_set_sda(bool level) {
+    (void)level;
+    drv_sim_bus_time_us += 5;
+}
+
+static bool drv_sim_read_sda() {
+    return drv_sim_stuck_clocks == 0;
+}
+
+static void drv_sim_reinit() {
+    drv_sim_scl = true;
+}
+
+DRV8214_BusRecoveryHooks drv8214_sim_bus_recovery_hooks() {
+    DRV8214_BusRecoveryHooks hooks;
+    hooks.set_scl = drv_sim_set_scl;
+    hooks.set_sda = drv_sim_set_sda;
+    hooks.read_sda = drv_sim_read_sda;
+    hooks.reinit = drv_sim_reinit;
+    return hooks;
+}
+
+// Decide the outcome of an attempt and account the bus time it takes
+static uint8_t drv_sim_attempt(DRV8214Sim* device, bool read, uint8_t length) {
+    if (drv_sim_stuck_clocks > 0) {
+        drv_sim_bus_time_us += (uint64_t)drv8214_i2c_timeout_ms * 1000;
+        return DRV8214_I2C_TIMEOUT;
+    }
+    if (drv_sim_faults.nack_rate > 0.0f || drv_sim_faults.timeout_rate > 0.0f) {
+        drv_sim_rng ^= drv_sim_rng << 13;
+        drv_sim_rng ^= drv_sim_rng >> 17;
+        drv_sim_rng ^= drv_sim_rng << 5;
+        float draw = (drv_sim_rng >> 8) * (1.0f / 16777216.0f);
+        if (draw < drv_sim_faults.timeout_rate) {
+            drv_sim_bus_time_us += (uint64_t)drv8214_i2c_timeout_ms * 1000;
+            return DRV8214_I2C_TIMEOUT;
+        }
+        if (draw < drv_sim_faults.timeout_rate + drv_sim_faults.nack_rate) { device = nullptr; }
+    }
+    if (device == nullptr) {
+        drv_sim_bus_time_us += drv8214_bus_transfer_us(false, 0, DRV8214_SIM_BUS_HZ) / 2; // Start, address, stop
+        return DRV8214_I2C_NACK;
+    }
+    drv_sim_bus_time_us += drv8214_bus_transfer_us(read, length, DRV8214_SIM_BUS_HZ);
+    return DRV8214_I2C_OK;
+}
+
+uint8_t DRV8214_SimBus::write(uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length) {
+    DRV8214Sim* device = drv8214_sim_find(address);
+    uint8_t result = drv_sim_attempt(device, false, length);
+    if (result == DRV8214_I2C_OK) { device->write(reg, data, length); }
+    return result;
+}
+
+uint8_t DRV8214_SimBus::read(uint8_t address, uint8_t reg, uint8_t* data, uint8_t length) {
+    DRV8214Sim* device = drv8214_sim_find(address);
+    uint8_t result = drv_sim_attempt(device, true, length);
+    if (result == DRV8214_I2C_OK) {
+        device->read(reg, data, length);
+    } else {
+        memset(data, 0, length); // No device acknowledges this address
+    }
+    return result;
+}
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+#include "drv8214_telemetry.h"
+#include <string.h>
+
+static const uint8_t drv_telemetry_magic[4] = { 'D', '8', 'T', 'L' };
+
+#define DRV8214_TELEMETRY_BLOCK_HEADER  5     // Marker, driver ID, count, payload length
+#define DRV8214_TELEMETRY_ORDER2        0x80  // Mode byte: second-order residuals
+#define DRV8214_TELEMETRY_WIDTH         0x3F  // Mode byte: bits per residual
+
+// --- Bit Packing ---
+
+struct DRV8214_BitWriter {
+    uint8_t* out;
+    uint16_t length;
+    uint64_t bits;      // Pending bits, LSB first
+    uint8_t  pending;   // Number of pending bits
+
+    void put(uint32_t value, uint8_t width) {
+        bits |= (uint64_t)value << pending;
+        pending += width;
+        while (pending >= 8) {
+            out[length++] = (uint8_t)bits;
+            bits >>= 8;
+            pending -= 8;
+        }
+    }
+    void align() {
+        if (pending) { out[length++] = (uint8_t)bits; }
+        bits = 0;
+        pending = 0;
+    }
+    void varint(uint32_t value) {
+        while (value >= 0x80) {
+            out[length++] = (uint8_t)(value | 0x80);
+            value >>= 7;
+        }
+        out[length++] = (uint8_t)value;
+    }
+};
+
+struct DRV8214_BitReader {
+    const uint8_t* data;
+    size_t   length;
+    size_t   offset;
+    uint64_t bits;
+    uint8_t  pending;
+    bool     error;     // Read past the end, or malformed varint
+
+    uint32_t get(uint8_t width) {
+        while (pending < width) {
+            if (offset >= length) { error = true; return 0; }
+            bits |= (uint64_t)data[offset++] << pending;
+            pending += 8;
+        }
+        uint32_t value = (uint32_t)(bits & ((width == 32) ? 0xFFFFFFFFull : ((1ull << width) - 1)));
+        bits >>= width;
+        pending -= width;
+        return value;
+    }
+    void align() {
+        bits = 0;
+        pending = 0;
+    }
+    uint32_t varint() {
+        uint32_t value = 0;
+        for (uint8_t shift = 0; shift < 35; shift += 7) {
+            if (offset >= length) { break; }
+            uint8_t byte = data[offset++];
+            value |= (uint32_t)(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) { return value; }
+        }
+        error = true;
+        return 0;
+    }
+};
+
+// --- Columns ---
+// Residuals are computed modulo 2^bits of the field type T, zigzag-mapped so small negative steps stay small.
+
+template <typename T>
+static inline uint32_t drv_zigzag(T residual) {
+    const uint8_t bits = 8 * sizeof(T);
+    uint32_t sign = (uint32_t)(residual >> (bits - 1)) & 1;
+    return (uint32_t)(T)(((uint32_t)residual << 1) ^ (0u - sign));
+}
+
+template <typename T>
+static inline T drv_unzigzag(uint32_t value) {
+    return (T)((value >> 1) ^ (0u - (value & 1)));
+}
+
+static inline uint8_t drv_width(uint32_t value) {
+    uint8_t width = 0;
+    while (value) { width++; value >>= 1; }
+    return width;
+}
+
+template <typename T>
+static inline T drv_residual(const T* values, uint8_t k, bool order2) {
+    T delta = (T)(values[k] - values[k - 1]);
+    if (!order2 || k < 2) { return delta; }
+    return (T)(delta - (T)(values[k - 1] - values[k - 2]));
+}
+
+template <typename T>
+static void drv_encode_column(DRV8214_BitWriter& writer, const T* values, uint8_t count) {
+    // Width of both orders, from the OR of the residuals
+    uint32_t any1 = 0, any2 = 0;
+    for (uint8_t k = 1; k < count; k++) {
+        any1 |= drv_zigzag<T>(drv_residual(values, k, false));
+        any2 |= drv_zigzag<T>(drv_residual(values, k, true));
+    }
+    uint8_t width1 = drv_width(any1), width2 = drv_width(any2);
+    bool order2 = width2 < width1;
+    uint8_t width = order2 ? width2 : width1;
+
+    writer.varint(values[0]);
+    writer.out[writer.length++] = (uint8_t)((order2 ? DRV8214_TELEMETRY_ORDER2 : 0) | width);
+    if (width) {
+        for (uint8_t k = 1; k < count; k++) { writer.put(drv_zigzag<T>(drv_residual(values, k, order2)), width); }
+        writer.align();
+    }
+}
+
+template <typename T>
+static bool drv_decode_column(DRV8214_BitReader& reader, T* values, uint8_t count) {
+    values[0] = (T)reader.varint();
+    if (reader.error || reader.offset >= reader.length) { return false; }
+    uint8_t mode = reader.data[reader.offset++];
+    uint8_t width = mode & DRV8214_TELEMETRY_WIDTH;
+    if (width > 8 * sizeof(T)) { return false; }
+    bool order2 = (mode & DRV8214_TELEMETRY_ORDER2) != 0;
+    T delta = 0;
+    for (uint8_t k = 1; k < count; k++) {
+        T residual = width ? drv_unzigzag<T>(reader.get(width)) : 0;
+        delta = (order2 && k >= 2) ? (T)(delta + residual) : residual;
+        values[k] = (T)(values[k - 1] + delta);
+    }
+    reader.align();
+    return !reader.error;
+}
+
+// --- Encoding ---
+
+uint8_t drv8214_telemetry_header(uint8_t* out) {
+    memcpy(out, drv_telemetry_magic, sizeof(drv_telemetry_magic));
+    out[4] = DRV8214_TELEMETRY_VERSION;
+    return DRV8214_TELEMETRY_HEADER_BYTES;
+}
+
+uint16_t drv8214_telemetry_encode_block(const DRV8214_TelemetryBlock& block, uint8_t* out) {
+    if (block.count == 0) { return 0; }
+    DRV8214_BitWriter writer = { out, DRV8214_TELEMETRY_BLOCK_HEADER, 0, 0 }; // Header completed once the payload length is known
+    drv_encode_column(writer, block.timestamp_us, block.count);
+    drv_encode_column(writer, block.fault, block.count);
+    drv_encode_column(writer, block.ripple_count, block.count);
+    drv_encode_column(writer, block.speed, block.count);
+    drv_encode_column(writer, block.voltage, block.count);
+    drv_encode_column(writer, block.current, block.count);
+    drv_encode_column(writer, block.duty, block.count);
+
+    uint16_t payload = writer.length - DRV8214_TELEMETRY_BLOCK_HEADER;
+    out[0] = DRV8214_TELEMETRY_BLOCK_MARKER;
+    out[1] = block.driver_id;
+    out[2] = block.count;
+    out[3] = (uint8_t)payload;
+    out[4] = (uint8_t)(payload >> 8);
+    return writer.length;
+}
+
+void DRV8214TelemetryWriter::add(const DRV8214_Status& status, uint32_t timestamp_us) {
+    uint8_t i = pending.count++;
+    pending.timestamp_us[i] = timestamp_us;
+    pending.fault[i]        = status.fault;
+    pending.ripple_count[i] = status.ripple_count;
+    pending.speed[i]        = status.speed;
+    pending.voltage[i]      = status.voltage;
+    pending.current[i]      = status.current;
+    pending.duty[i]         = status.duty;
+    if (pending.count == DRV8214_TELEMETRY_BLOCK) { flush(); }
+}
+
+void DRV8214TelemetryWriter::flush() {
+    if (pending.count == 0) { return; }
+    uint16_t length = drv8214_telemetry_encode_block(pending, encoded);
+    pending.count = 0;
+    bytes_written += length;
+    if (sink) { sink(encoded, length, context); }
+}
+
+// --- Decoding ---
+
+bool drv8214_telemetry_check_header(const uint8_t* data, size_t length) {
+    return length >= DRV8214_TELEMETRY_HEADER_BYTES && memcmp(data, drv_telemetry_magic, sizeof(drv_telemetry_magic)) == 0 &&
+           data[4] == DRV8214_TELEMETRY_VERSION;
+}
+
+size_t drv8214_telemetry_decode_block(const uint8_t* data, size_t length, DRV8214_TelemetryBlock& block) {
+    if (length < DRV8214_TELEMETRY_BLOCK_HEADER || data[0] != DRV8214_TELEMETRY_BLOCK_MARKER) { return 0; }
+    uint8_t count = data[2];
+    size_t payload = data[3] | ((size_t)data[4] << 8);
+    if (count == 0 || count > DRV8214_TELEMETRY_BLOCK || DRV8214_TELEMETRY_BLOCK_HEADER + payload > length) { return 0; }
+
+    DRV8214_BitReader reader = { data + DRV8214_TELEMETRY_BLOCK_HEADER, payload, 0, 0, 0, false };
+    block.driver_id = data[1];
+    block.count = count;
+    bool ok = drv_decode_column(reader, block.timestamp_us, count) &&
+              drv_decode_column(reader, block.fault, count) &&
+              drv_decode_column(reader, block.ripple_count, count) &&
+              drv_decode_column(reader, block.speed, count) &&
+              drv_decode_column(reader, block.voltage, count) &&
+              drv_decode_column(reader, block.current, count) &&
+              drv_decode_column(reader, block.duty, count);
+    if (!ok || reader.offset != payload) { return 0; }
+    return DRV8214_TELEMETRY_BLOCK_HEADER + payload;
+}
+
+static inline char* drv_put_uint(char* out, uint32_t value, char separator) {
+    char digits[10];
+    uint8_t n = 0;
+    do { digits[n++] = (char)('0' + value % 10); value /= 10; } while (value);
+    while (n) { *out++ = digits[--n]; }
+    *out++ = separator;
+    return out;
+}
+
+size_t drv8214_telemetry_format_csv(const DRV8214_TelemetryBlock& block, uint8_t i, char* buffer, size_t length) {
+    if (length < DRV8214_TELEMETRY_CSV_MAX_ROW || i >= block.count) { return 0; }
+    char* out = buffer;
+    out = drv_put_uint(out, block.timestamp_us[i], ',');
+    out = drv_put_uint(out, block.driver_id, ',');
+    out = drv_put_uint(out, block.fault[i], ',');
+    out = drv_put_uint(out, block.ripple_count[i], ',');
+    out = drv_put_uint(out, block.speed[i], ',');
+    out = drv_put_uint(out, block.voltage[i], ',');
+    out = drv_put_uint(out, block.current[i], ',');
+    out = drv_put_uint(out, block.duty[i], '\n');
+    return (size_t)(out - buffer);
+}
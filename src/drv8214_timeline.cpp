@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+#include "drv8214_timeline.h"
+
+#if DRV8214_TIMELINE
+
+#include <stdio.h>
+#include <string.h>
+
+bool drv8214_timeline_enabled = false;
+uint32_t (*drv8214_timeline_clock)() = drv8214_time_micros;
+
+static DRV8214_TimelineEvent drv8214_timeline_buffer[DRV8214_TIMELINE_EVENTS];
+static volatile uint32_t drv8214_timeline_used = 0;
+static volatile uint32_t drv8214_timeline_lost = 0;    // Spans lost because the buffer was full
+
+void drv8214_timeline_start(uint32_t (*clock)()) {
+    drv8214_timeline_clock = clock ? clock : drv8214_time_micros;
+    drv8214_timeline_enabled = true;
+}
+
+void drv8214_timeline_stop() {
+    drv8214_timeline_enabled = false;
+}
+
+void drv8214_timeline_clear() {
+    drv8214_timeline_used = 0;
+    drv8214_timeline_lost = 0;
+}
+
+void drv8214_timeline_push(const DRV8214_TimelineEvent& event) {
+    uint32_t used = drv8214_timeline_used;
+    if (used >= DRV8214_TIMELINE_EVENTS) {
+        drv8214_timeline_lost = drv8214_timeline_lost + 1; // Keep the beginning of the capture, like the log ring
+        return;
+    }
+    drv8214_timeline_buffer[used] = event;
+    drv8214_timeline_used = used + 1;
+}
+
+uint32_t drv8214_timeline_count() {
+    return drv8214_timeline_used;
+}
+
+uint32_t drv8214_timeline_dropped() {
+    return drv8214_timeline_lost;
+}
+
+const DRV8214_TimelineEvent* drv8214_timeline_events() {
+    return drv8214_timeline_buffer;
+}
+
+// --- JSON export ---
+
+static void drv8214_timeline_write(DRV8214_TimelineWriter write, void* context, const char* text) {
+    write(text, strlen(text), context);
+}
+
+void drv8214_timeline_dump_json(DRV8214_TimelineWriter write, void* context) {
+    char line[192];
+    uint8_t tracks[(DRV8214_TIMELINE_BUS_TRACK + 8) / 8]; // Bit per track seen
+    memset(tracks, 0, sizeof(tracks));
+    uint32_t count = drv8214_timeline_used;
+
+    // Spans are stored when they close, nested ones first. The viewers sort them by timestamp.
+    drv8214_timeline_write(write, context, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    for (uint32_t i = 0; i < count; i++) {
+        const DRV8214_TimelineEvent& event = drv8214_timeline_buffer[i];
+        bool bus = (event.track == DRV8214_TIMELINE_BUS_TRACK);
+        uint16_t track = (event.track <= DRV8214_TIMELINE_BUS_TRACK) ? event.track : DRV8214_TIMELINE_BUS_TRACK;
+        tracks[track / 8] |= (uint8_t)(1 << (track % 8));
+        int length = snprintf(line, sizeof(line), "{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%lu,\"dur\":%lu,\"pid\":1,\"tid\":%u,\"args\":{\"address\":\"0x%02X\"",
+                              event.name, bus ? "bus" : "api", (unsigned long)event.start_us, (unsigned long)event.duration_us, event.track, event.address);
+        if (bus && length > 0 && length < (int)sizeof(line)) {
+            snprintf(line + length, sizeof(line) - length, ",\"reg\":\"0x%02X\",\"length\":%u,\"result\":%u", event.reg, event.length, event.result);
+        }
+        drv8214_timeline_write(write, context, line);
+        drv8214_timeline_write(write, context, "}},\n");
+    }
+
+    // Track names, the bus below the drivers
+    drv8214_timeline_write(write, context, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"DRV8214\"}}");
+    for (uint16_t track = 0; track <= DRV8214_TIMELINE_BUS_TRACK; track++) {
+        if (!(tracks[track / 8] & (1 << (track % 8)))) { continue; }
+        if (track == DRV8214_TIMELINE_BUS_TRACK) {
+            snprintf(line, sizeof(line), ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"I2C bus\"}}", track);
+        } else {
+            snprintf(line, sizeof(line), ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"driver %u\"}}", track, track);
+        }
+        drv8214_timeline_write(write, context, line);
+        snprintf(line, sizeof(line), ",\n{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"sort_index\":%u}}", track, track);
+        drv8214_timeline_write(write, context, line);
+    }
+    drv8214_timeline_write(write, context, "\n]}\n");
+}
+
+#endif // DRV8214_TIMELINE
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Boot cost of init() against a simulated device, in transfers, register bytes and bus time, for three starts:
+//   por  : the device has just been powered, only the registers that differ from their reset value are written
+//   full : the device holds another configuration, the whole init sequence runs
+//   warm : the MCU restarted and the device already holds the configuration, nothing is written
+//
+// Build: g++ -O2 -Iinclude -DDRV8214_BUS_POLICY=DRV8214_SimBus -DDRV8214_LOG_MODE=DRV8214_LOG_NONE
+//            tools/drv8214_boot_bench.cpp src/*.cpp -o drv8214_boot_bench
+
+#include "drv8214_sim.h"
+#include <stdio.h>
+
+struct BootCase {
+    const char*    name;
+    DRV8214_Config config;
+};
+
+static void measure(const char* start, DRV8214& driver, const DRV8214_Config& config) {
+    drv8214_i2c_reset_stats();
+    drv8214_sim_bus_reset_time();
+    uint8_t status = driver.init(config);
+    DRV8214_I2CStats stats;
+    drv8214_i2c_get_stats(stats);
+    printf("  %-5s %6u %9u %9u %8u\n", start, stats.transfers, stats.bytes, (unsigned)drv8214_sim_bus_time_us(), status);
+}
+
+int main() {
+    BootCase cases[4];
+    cases[0].name = "default";
+    cases[1].name = "voltage";
+    cases[1].config.regulation_mode = VOLTAGE;
+    cases[1].config.voltage_range = false;
+    cases[2].name = "current";
+    cases[2].config.regulation_mode = CURRENT_CYCLES;
+    cases[2].config.stall_behavior = true;
+    cases[3].name = "phen";
+    cases[3].config.control_mode = PH_EN;
+    cases[3].config.soft_start_stop_enabled = true;
+    cases[3].config.inrush_duration = 200;
+
+    DRV8214Sim sim(DRV8214_I2C_ADDR_00);
+    drv8214_sim_attach(&sim);
+    for (const BootCase& boot : cases) {
+        printf("%s\n  %-5s %6s %9s %9s %8s\n", boot.name, "start", "xfers", "bytes", "bus_us", "status");
+
+        sim.powerOnReset();
+        DRV8214 por(DRV8214_I2C_ADDR_00, 0, 1000, 12, 5, 50, 3000);
+        measure("por", por, boot.config);
+
+        // Another application configured the device earlier
+        sim.setRegister(DRV8214_RC_CTRL4, (uint8_t)(boot.config.kmc + 1));
+        DRV8214 full(DRV8214_I2C_ADDR_00, 0, 1000, 12, 5, 50, 3000);
+        measure("full", full, boot.config);
+
+        DRV8214 warm(DRV8214_I2C_ADDR_00, 0, 1000, 12, 5, 50, 3000);
+        measure("warm", warm, boot.config);
+
+        for (uint8_t reg = DRV8214_CONFIG0; reg <= DRV8214_RC_CTRL8; reg++) {
+            if (sim.getRegister(reg) != warm.getShadowRegister(reg)) { printf("  mismatch at 0x%02X\n", reg); }
+        }
+    }
+    return 0;
+}
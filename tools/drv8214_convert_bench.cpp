@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Batch conversion of raw status bytes into volts, amps, percent and RPM.
+//   check : every raw value, under every voltage range, CS_GAIN_SEL and W_SCALE setting, converted by the batch kernels
+//           must be bit-identical to the DRV8214 conversions. Odd lengths and unaligned buffers cover the scalar tails.
+//   bench : samples per second of the DRV8214 methods called once per sample against the batch kernels.
+//
+// Build: g++ -O2 -Iinclude -DDRV8214_BUS_POLICY=DRV8214_SimBus -DDRV8214_LOG_MODE=DRV8214_LOG_NONE
+//            tools/drv8214_convert_bench.cpp src/*.cpp -o drv8214_convert_bench
+// Add -DDRV8214_CONVERT_SCALAR to measure the portable loops instead of SSE2/NEON.
+
+#include "drv8214_sim.h"
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+#define BENCH_SAMPLES 4096
+
+static uint32_t mismatches = 0;
+
+static bool same(float a, float b) { return memcmp(&a, &b, sizeof(float)) == 0; }
+
+// All 256 raw values plus an odd tail, starting one byte off a 16-byte boundary
+static void check_driver(DRV8214& driver) {
+    DRV8214_UnitScales scales;
+    driver.getUnitScales(scales);
+    const uint32_t count = 256 + 7;
+    std::vector<uint8_t> storage(count + 1);
+    uint8_t* raw = storage.data() + 1;
+    for (uint32_t i = 0; i < count; i++) { raw[i] = (uint8_t)(i * 151 + 3); } // Permutation of 0..255, then a few repeats
+    std::vector<float> volts_per_lsb(count, scales.volts_per_lsb), volts_max(count, scales.volts_max);
+    std::vector<float> amps_per_lsb(count, scales.amps_per_lsb), rpm_per_lsb(count, scales.rpm_per_lsb);
+    std::vector<float> volts(count), amps(count), rpm(count);
+    std::vector<uint8_t> duty(count);
+
+    drv8214_convert_voltage_batch(raw, volts_per_lsb.data(), volts_max.data(), volts.data(), count);
+    drv8214_convert_current_batch(raw, amps_per_lsb.data(), amps.data(), count);
+    drv8214_convert_duty_batch(raw, duty.data(), count);
+    drv8214_convert_speed_batch(raw, rpm_per_lsb.data(), rpm.data(), count);
+    for (uint32_t i = 0; i < count; i++) {
+        if (!same(volts[i], driver.convertMotorVoltage(raw[i])) ||
+            !same(amps[i], driver.convertMotorCurrent(raw[i])) ||
+            duty[i] != driver.convertDutyCycle(raw[i]) ||
+            !same(rpm[i], drv8214_convert_speed(raw[i], scales.rpm_per_lsb))) {
+            if (mismatches++ < 10) { printf("  mismatch at raw 0x%02X\n", raw[i]); }
+        }
+    }
+}
+
+static double rate(std::chrono::steady_clock::time_point start, uint32_t samples) {
+    double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return samples / s / 1e6;
+}
+
+int main() {
+    DRV8214Sim sim(DRV8214_I2C_ADDR_00);
+    drv8214_sim_attach(&sim);
+    DRV8214 driver(DRV8214_I2C_ADDR_00, 0, 1000, 12, 5, 50, 3000);
+    DRV8214_Config config;
+    driver.init(config);
+
+    // Every setting that changes a scale
+    uint32_t settings = 0;
+    for (uint8_t range = 0; range < 3; range++) {
+        driver.setVoltageRange(range == 0);
+        driver.setOvervoltageProtection(range == 1);
+        for (uint8_t gain = 0; gain < 8; gain++) {
+            driver.configureRippleCount0(FIELD_RC_CTRL0_CS_GAIN_SEL::set(gain).apply(driver.getShadowRegister(DRV8214_RC_CTRL0)));
+            for (uint8_t w_scale = 0; w_scale < 4; w_scale++) {
+                driver.configureControl0(FIELD_REG_CTRL0_W_SCALE::set(w_scale).apply(driver.getShadowRegister(DRV8214_REG_CTRL0)));
+                check_driver(driver);
+                settings++;
+            }
+        }
+    }
+    printf("isa %s, %u settings checked: %s\n\n", drv8214_convert_isa(), settings, mismatches ? "MISMATCH" : "bit-exact");
+
+    // Throughput, a mix of drivers with their own scales
+    std::vector<uint8_t> raw(BENCH_SAMPLES);
+    std::vector<float> volts_per_lsb(BENCH_SAMPLES), volts_max(BENCH_SAMPLES), amps_per_lsb(BENCH_SAMPLES), rpm_per_lsb(BENCH_SAMPLES);
+    std::vector<float> volts(BENCH_SAMPLES), amps(BENCH_SAMPLES), rpm(BENCH_SAMPLES);
+    std::vector<uint8_t> duty(BENCH_SAMPLES);
+    DRV8214_UnitScales scales;
+    driver.getUnitScales(scales);
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++) {
+        raw[i] = (uint8_t)(i * 37);
+        volts_per_lsb[i] = scales.volts_per_lsb;
+        volts_max[i] = scales.volts_max;
+        amps_per_lsb[i] = scales.amps_per_lsb;
+        rpm_per_lsb[i] = scales.rpm_per_lsb;
+    }
+    const uint32_t passes = 2000;
+    float sink = 0.0f;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t p = 0; p < passes; p++) {
+        for (uint32_t i = 0; i < BENCH_SAMPLES; i++) {
+            volts[i] = driver.convertMotorVoltage(raw[i]);
+            amps[i] = driver.convertMotorCurrent(raw[i]);
+            duty[i] = driver.convertDutyCycle(raw[i]);
+            rpm[i] = drv8214_convert_speed(raw[i], scales.rpm_per_lsb);
+        }
+        sink += volts[p % BENCH_SAMPLES] + amps[p % BENCH_SAMPLES] + duty[p % BENCH_SAMPLES] + rpm[p % BENCH_SAMPLES];
+    }
+    double per_sample = rate(start, passes * BENCH_SAMPLES);
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t p = 0; p < passes; p++) {
+        drv8214_convert_voltage_batch(raw.data(), volts_per_lsb.data(), volts_max.data(), volts.data(), BENCH_SAMPLES);
+        drv8214_convert_current_batch(raw.data(), amps_per_lsb.data(), amps.data(), BENCH_SAMPLES);
+        drv8214_convert_duty_batch(raw.data(), duty.data(), BENCH_SAMPLES);
+        drv8214_convert_speed_batch(raw.data(), rpm_per_lsb.data(), rpm.data(), BENCH_SAMPLES);
+        sink += volts[p % BENCH_SAMPLES] + amps[p % BENCH_SAMPLES] + duty[p % BENCH_SAMPLES] + rpm[p % BENCH_SAMPLES];
+    }
+    double batch = rate(start, passes * BENCH_SAMPLES);
+
+    printf("%-22s %10s\n", "path", "Msamples/s");
+    printf("%-22s %10.1f\n", "DRV8214 per sample", per_sample);
+    printf("%-22s %10.1f\n", "batch kernels", batch);
+    printf("(checksum %.1f)\n", sink);
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Status processing cost per driver, from 10 to 10000 drivers: one DRV8214 object per driver (decode, updatePosition()
+// and fault test per object) against the DRV8214Fleet batch operations. The snapshots are generated beforehand, only
+// the processing is timed. Both paths must end with the same positions and fault counts. The last line gives the
+// crossover: the smallest fleet from which the batch operations are faster at every measured size.
+//
+// Build: g++ -O3 -march=native -Iinclude -DDRV8214_BUS_POLICY=DRV8214_SimBus -DDRV8214_LOG_MODE=DRV8214_LOG_NONE
+//            tools/drv8214_fleet_bench.cpp src/*.cpp -o drv8214_fleet_bench
+
+#include "drv8214_fleet.h"
+#include "drv8214_sim.h"
+#include <stdio.h>
+#include <chrono>
+#include <vector>
+
+#define FLEET_MAX     10000
+#define BENCH_FRAMES  16      // Pre-generated status frames, replayed in a loop
+
+static DRV8214Fleet<FLEET_MAX> fleet;
+static uint8_t flagged[FLEET_MAX];
+
+static uint32_t rng_state = 12345;
+static uint32_t next_random() {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return rng_state >> 8;
+}
+
+static double elapsed_ns(std::chrono::steady_clock::time_point start) {
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Odometry and fault check of one frame through the regular objects
+static uint32_t process_objects(std::vector<DRV8214>& drivers, const uint8_t* frame) {
+    uint32_t faulted = 0;
+    for (size_t i = 0; i < drivers.size(); i++) {
+        const uint8_t* raw = frame + i * DRV8214_FLEET_SLOT_BYTES;
+        DRV8214_Status status;
+        status.fault        = raw[DRV8214_FAULT];
+        status.speed        = raw[DRV8214_RC_STATUS1];
+        status.ripple_count = (raw[DRV8214_RC_STATUS3] << 8) | raw[DRV8214_RC_STATUS2];
+        status.voltage      = raw[DRV8214_REG_STATUS1];
+        status.current      = raw[DRV8214_REG_STATUS2];
+        status.duty         = raw[DRV8214_REG_STATUS3];
+        drivers[i].updatePosition(status);
+        if (status.fault & (FAULT_STALL | FAULT_OCP)) { faulted++; }
+    }
+    return faulted;
+}
+
+static uint32_t process_fleet(const uint8_t* frame) {
+    fleet.decodeStatus(frame);
+    fleet.updateOdometry();
+    return fleet.checkFaults(FAULT_STALL | FAULT_OCP, flagged);
+}
+
+// Returns the speedup of the fleet over the objects
+static double run(uint16_t count) {
+    // Frames with the ripple counters moving forward by up to 255 ripples, wrapping around, and rare faults
+    std::vector<uint8_t> frames((size_t)BENCH_FRAMES * count * DRV8214_FLEET_SLOT_BYTES);
+    std::vector<uint16_t> counters(count, 0);
+    for (uint32_t f = 0; f < BENCH_FRAMES; f++) {
+        for (uint16_t i = 0; i < count; i++) {
+            uint8_t* raw = &frames[((size_t)f * count + i) * DRV8214_FLEET_SLOT_BYTES];
+            counters[i] += next_random() & 0xFF;
+            raw[DRV8214_FAULT]       = (next_random() % 64 == 0) ? FAULT_STALL : 0;
+            raw[DRV8214_RC_STATUS1]  = next_random() & 0xFF;
+            raw[DRV8214_RC_STATUS2]  = counters[i] & 0xFF;
+            raw[DRV8214_RC_STATUS3]  = counters[i] >> 8;
+            raw[DRV8214_REG_STATUS1] = next_random() & 0xFF;
+            raw[DRV8214_REG_STATUS2] = next_random() & 0xFF;
+            raw[DRV8214_REG_STATUS3] = next_random() & 0x3F;
+        }
+    }
+
+    std::vector<DRV8214> drivers;
+    drivers.reserve(count);
+    fleet.clear();
+    for (uint16_t i = 0; i < count; i++) {
+        drivers.push_back(DRV8214((uint8_t)(DRV8214_I2C_ADDR_00 + i % 9), (uint8_t)i, 1000, 12, 5, 50, 3000));
+        fleet.add((uint8_t)(DRV8214_I2C_ADDR_00 + i % 9));
+    }
+
+    uint32_t iterations = 2000000 / count;
+    if (iterations < 100) { iterations = 100; }
+    iterations -= iterations % BENCH_FRAMES; // Same number of passes over every frame
+
+    uint64_t faults_objects = 0, faults_fleet = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t it = 0; it < iterations; it++) {
+        faults_objects += process_objects(drivers, &frames[(size_t)(it % BENCH_FRAMES) * count * DRV8214_FLEET_SLOT_BYTES]);
+    }
+    double objects_ns = elapsed_ns(start);
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t it = 0; it < iterations; it++) {
+        faults_fleet += process_fleet(&frames[(size_t)(it % BENCH_FRAMES) * count * DRV8214_FLEET_SLOT_BYTES]);
+    }
+    double fleet_ns = elapsed_ns(start);
+
+    bool match = (faults_objects == faults_fleet);
+    for (uint16_t i = 0; i < count && match; i++) { match = (drivers[i].getPosition() == fleet.positions()[i]); }
+
+    double updates = (double)iterations * count;
+    printf("%7u %10u %12.2f %12.2f %8.1fx  %s\n", count, iterations, objects_ns / updates, fleet_ns / updates,
+           objects_ns / fleet_ns, match ? "ok" : "MISMATCH");
+    return objects_ns / fleet_ns;
+}
+
+// Bus path of the fleet against simulated devices: status bursts, NPOR detection and restore from the shadow image
+static bool check_bus() {
+    DRV8214Sim sims[4] = { DRV8214Sim(DRV8214_I2C_ADDR_00), DRV8214Sim(DRV8214_I2C_ADDR_01), DRV8214Sim(DRV8214_I2C_ADDR_10), DRV8214Sim(DRV8214_I2C_ADDR_11) };
+    fleet.clear();
+    for (DRV8214Sim& sim : sims) {
+        drv8214_sim_attach(&sim);
+        int16_t i = fleet.add(sim.getAddress());
+        fleet.setShadowRegister(i, DRV8214_RC_CTRL4, 42); // Stands for the configuration of the application
+        fleet.restoreConfiguration(i, true); // Acknowledges the power-up NPOR, like init()
+    }
+    sims[2].powerOnReset();
+    bool ok = (fleet.readStatus() == 0);
+    fleet.decodeStatus();
+    ok = ok && (fleet.checkFaults(FAULT_NPOR, flagged) == 1) && flagged[2];
+    ok = ok && (fleet.restoreConfiguration(2, true) == DRV8214_OK) && (sims[2].getRegister(DRV8214_RC_CTRL4) == 42);
+    for (DRV8214Sim& sim : sims) { drv8214_sim_detach(&sim); }
+    return ok;
+}
+
+int main() {
+    printf("bus path: %s\n\n", check_bus() ? "ok" : "FAILED");
+    printf("%7s %10s %12s %12s %9s\n", "drivers", "iterations", "objects_ns", "fleet_ns", "speedup");
+    const uint16_t counts[] = { 10, 16, 20, 32, 64, 100, 1000, 10000 };
+    const uint8_t sizes = sizeof(counts) / sizeof(counts[0]);
+    double speedup[sizes];
+    for (uint8_t i = 0; i < sizes; i++) { speedup[i] = run(counts[i]); }
+
+    // Small fleets fit in no vector block, the kernels then run their scalar remainder and lose to the objects
+    int8_t crossover = sizes;
+    while (crossover > 0 && speedup[crossover - 1] > 1.0) { crossover--; }
+    if (crossover == 0) { printf("\nfleet faster at every size measured\n"); }
+    else if (crossover == sizes) { printf("\nfleet slower at every size measured, keep DRV8214 objects\n"); }
+    else { printf("\nfleet faster from %u drivers, below that keep DRV8214 objects\n", counts[crossover]); }
+    return 0;
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// RAM footprint of the library: per-instance cost of each object, static RAM of each feature and the constant
+// tables placed in flash. Code size per feature is reported by tools/drv8214_footprint.sh.
+//
+// Build: g++ -Os -Iinclude -DDRV8214_LOG_MODE=DRV8214_LOG_BINARY tools/drv8214_footprint.cpp -o drv8214_footprint
+//
+// The sizes depend on the target ABI, run it built with -m32 for a 32-bit MCU estimate. On a cross compiler that
+// cannot run the result, define DRV8214_INSTANCE_BUDGET to the allowed sizeof(DRV8214) and compile only:
+//   arm-none-eabi-g++ -Os -Iinclude -DDRV8214_INSTANCE_BUDGET=80 -fsyntax-only tools/drv8214_footprint.cpp
+
+#include "DRV8214.h"
+#include "drv8214_energy.h"
+#include "drv8214_ripple_dsp.h"
+#include "drv8214_regmap.h"
+#include <stdio.h>
+
+#ifdef DRV8214_INSTANCE_BUDGET
+    static_assert(sizeof(DRV8214) <= DRV8214_INSTANCE_BUDGET, "DRV8214 instance grew over its budget");
+#endif
+
+static void row(const char* name, size_t bytes, const char* note) {
+    printf("  %-28s %6u  %s\n", name, (unsigned)bytes, note);
+}
+
+int main() {
+    printf("Per instance (RAM)\n");
+    row("DRV8214", sizeof(DRV8214), "one per driver");
+    row("DRV8214EnergyMeter", sizeof(DRV8214EnergyMeter), "optional, one per driver");
+    row("DRV8214RippleDetector", sizeof(DRV8214RippleDetector), "host cross-check");
+
+    printf("Transient (stack)\n");
+    row("DRV8214_Config", sizeof(DRV8214_Config), "read by init(), not kept");
+    row("DRV8214_Status", sizeof(DRV8214_Status), "status snapshot");
+    row("register image", DRV8214_REG_COUNT, "readRegisters(), printRegisters()");
+
+    printf("Per feature (static RAM)\n");
+    row("async queue", DRV8214_ASYNC_QUEUE_SIZE * sizeof(DRV8214_AsyncOp), "DRV8214_ASYNC_QUEUE_SIZE operations, callbacks excluded");
+    #if DRV8214_LOG_MODE == DRV8214_LOG_BINARY
+        row("binary log ring", DRV8214_LOG_RING_SIZE * sizeof(DRV8214_LogRecord), "DRV8214_LOG_RING_SIZE records");
+    #else
+        row("binary log ring", 0, "DRV8214_LOG_MODE is not DRV8214_LOG_BINARY");
+    #endif
+    #if DRV8214_I2C_TRACE
+        row("I2C trace ring", DRV8214_I2C_TRACE_RING_SIZE, "DRV8214_I2C_TRACE_RING_SIZE bytes, on by default on Linux only");
+    #else
+        row("I2C trace ring", 0, "DRV8214_I2C_TRACE is 0");
+    #endif
+    row("I2C statistics", sizeof(DRV8214_I2CStats), "drv8214_i2c_get_stats()");
+
+    printf("Constant tables (flash)\n");
+    row("reset values", sizeof(DRV8214_RESET_VALUES), "DRV8214_RESET_VALUES");
+    row("register descriptors", sizeof(DRV8214_REGISTER_TABLE), "drv8214_regmap.h, names excluded");
+    row("field descriptors", sizeof(DRV8214_FIELD_TABLE), "drv8214_regmap.h, names excluded");
+    return 0;
+}
@@ -0,0 +1,22 @@
+#!/bin/sh
+# Code size of each feature of the library: every source file is compiled on its own with the given compiler and
+# flags, and the text, data and bss of the object reported. Run from the repository root.
+#
+# Usage: CXX=arm-none-eabi-g++ SIZE=arm-none-eabi-size CXXFLAGS="-Os -mcpu=cortex-m4 -mthumb" tools/drv8214_footprint.sh [-Dflags...]
+#        Extra arguments are passed to the compiler, e.g. -DDRV8214_LOG_MODE=DRV8214_LOG_NONE
+
+CXX=${CXX:-g++}
+SIZE=${SIZE:-size}
+CXXFLAGS=${CXXFLAGS:--Os}
+OUT=$(mktemp -d) || exit 1
+trap 'rm -rf "$OUT"' EXIT
+
+printf '%-28s %8s %8s %8s\n' feature text data bss
+for src in src/*.cpp; do
+    name=$(basename "$src" .cpp)
+    if ! $CXX $CXXFLAGS -std=gnu++11 -ffunction-sections -fdata-sections -Iinclude "$@" -c "$src" -o "$OUT/$name.o"; then
+        echo "$name: compilation failed" >&2
+        continue
+    fi
+    $SIZE "$OUT/$name.o" | awk -v name="$name" 'NR == 2 { printf "%-28s %8d %8d %8d\n", name, $1, $2, $3 }'
+done
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Per-method latency histograms on a contended bus, and their cost.
+//   buckets  : every duration up to 2^27 us falls in a bucket whose bounds hold it, and the percentiles of a
+//              reference distribution stay within one bucket (25 %) of the exact values.
+//   report   : nine simulated drivers in a control loop (status read and voltage target every iteration, a move
+//              started every 10), with 1 % of the transfers NACKed and 0.1 % hanging until the 10 ms timeout.
+//              The clock is the bus time accounted by DRV8214_SimBus. The rare slow calls show up in p99.9 and max
+//              while p50 stays at the clean bus time. The histograms are scraped and reset every 5000 iterations.
+//   overhead : one timed scope, with a free clock (bookkeeping only) and with drv8214_time_micros().
+//
+// Build: g++ -O2 -Iinclude -DDRV8214_LATENCY=1 -DDRV8214_BUS_POLICY=DRV8214_SimBus -DDRV8214_LOG_MODE=DRV8214_LOG_NONE
+//            tools/drv8214_histogram_bench.cpp src/*.cpp -o drv8214_histogram_bench
+// Usage: drv8214_histogram_bench [iterations]   (default 20000)
+
+#include "drv8214_sim.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#if !DRV8214_LATENCY
+    #error "Build with -DDRV8214_LATENCY=1"
+#endif
+
+#define BENCH_DRIVERS  9
+#define BENCH_SCRAPE   5000
+#define BENCH_SCOPES   10000000
+
+static uint32_t bus_clock() { return (uint32_t)drv8214_sim_bus_time_us(); }
+
+static uint32_t ticks = 0;
+static uint32_t tick_clock() { return ticks++; }
+
+static void print_line(const char* line, void*) {
+    printf("  %s", line);
+}
+
+static bool check_buckets() {
+    for (uint32_t us = 0; us < (1u << 27); us = (us < 4096) ? us + 1 : us + us / 4096) {
+        uint8_t bucket = drv8214_latency_bucket(us);
+        uint32_t low = bucket ? drv8214_latency_bucket_max(bucket - 1) + 1 : 0;
+        bool last = (bucket == DRV8214_LATENCY_BUCKETS - 1);
+        if (us < low || (us > drv8214_latency_bucket_max(bucket) && !last)) {
+            printf("bucket check failed: %lu us in bucket %u [%lu, %lu]\n", (unsigned long)us, bucket, (unsigned long)low,
+                   (unsigned long)drv8214_latency_bucket_max(bucket));
+            return false;
+        }
+    }
+
+    // Log-normal-ish reference: mostly around 300 us, a tail up to 20 ms
+    static uint8_t slots[DRV8214_LATENCY_APIS];
+    uint8_t api = drv8214_latency_register("reference");
+    std::vector<uint32_t> samples;
+    srand(1);
+    for (uint32_t i = 0; i < 100000; i++) {
+        uint32_t us = 250 + rand() % 100;
+        if (rand() % 100 == 0) { us += rand() % 2000; }
+        if (rand() % 2000 == 0) { us += 10000 + rand() % 10000; }
+        samples.push_back(us);
+        drv8214_latency_record(slots, 0, api, us);
+    }
+    std::sort(samples.begin(), samples.end());
+    DRV8214_LatencyReport report;
+    drv8214_latency_report(slots[api] - 1, report, true);
+    const uint32_t exact[] = { samples[samples.size() / 2 - 1], samples[samples.size() * 99 / 100 - 1], samples[samples.size() * 999 / 1000 - 1], samples.back() };
+    const uint32_t binned[] = { report.p50_us, report.p99_us, report.p999_us, report.max_us };
+    const char* names[] = { "p50", "p99", "p99.9", "max" };
+    bool ok = true;
+    for (uint8_t i = 0; i < 4; i++) {
+        bool close = binned[i] >= exact[i] && binned[i] <= exact[i] + exact[i] / 4;
+        printf("  %-6s exact %6lu us, histogram %6lu us  %s\n", names[i], (unsigned long)exact[i], (unsigned long)binned[i], close ? "ok" : "FAILED");
+        ok &= close;
+    }
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    uint32_t iterations = (argc > 1) ? (uint32_t)atoi(argv[1]) : 20000;
+
+    printf("buckets\n");
+    if (!check_buckets()) { return 1; }
+
+    DRV8214Sim* sims[BENCH_DRIVERS];
+    DRV8214* drivers[BENCH_DRIVERS];
+    DRV8214_Config config;
+    config.regulation_mode = VOLTAGE;
+    for (uint8_t i = 0; i < BENCH_DRIVERS; i++) {
+        sims[i] = new DRV8214Sim(DRV8214_I2C_ADDR_00 + i);
+        drv8214_sim_attach(sims[i]);
+        drivers[i] = new DRV8214(DRV8214_I2C_ADDR_00 + i, i, 1000, 12, 5, 50, 3000);
+        drivers[i]->init(config);
+    }
+
+    drv8214_i2c_set_timeout(10);
+    drv8214_i2c_set_retries(2);
+    DRV8214_SimBusFaults faults;
+    faults.nack_rate = 0.01f;
+    faults.timeout_rate = 0.001f;
+    drv8214_sim_bus_set_faults(faults);
+    drv8214_latency_set_clock(bus_clock);
+    drv8214_latency_reset(); // Leave init() out
+    printf("\nreport\n");
+    for (uint32_t n = 0; n < iterations; n++) {
+        if (n % 10 == 0) { drivers[(n / 10) % BENCH_DRIVERS]->turnForward(0, 2.0f); }
+        for (uint8_t i = 0; i < BENCH_DRIVERS; i++) {
+            DRV8214_Status status;
+            drivers[i]->readStatus(status);
+            drivers[i]->setVoltageSpeed(1.0f + 0.001f * (n % 1000));
+        }
+        if ((n + 1) % BENCH_SCRAPE == 0 && n + 1 < iterations) {
+            // Periodic scrape: only the worst readStatus() of each period is kept here, the rest is discarded
+            uint32_t worst = 0;
+            DRV8214_LatencyReport report;
+            for (uint8_t i = 0; drv8214_latency_report(i, report, true); i++) {
+                if (report.max_us > worst && strcmp(report.api, "readStatus") == 0) { worst = report.max_us; }
+            }
+            printf("%lu iterations scraped, slowest readStatus() %lu us\n", (unsigned long)(n + 1), (unsigned long)worst);
+        }
+    }
+    drv8214_sim_bus_set_faults(DRV8214_SimBusFaults());
+    printf("last period, %d drivers, nack 1 %%, timeout 0.1 %% at 10 ms, 2 retries, bus time\n", BENCH_DRIVERS);
+    drv8214_latency_print(print_line, nullptr, true);
+
+    // Overhead of one scope, the API id is registered once like in the methods
+    uint8_t slots[DRV8214_LATENCY_APIS] = {};
+    uint8_t depth = 0;
+    uint8_t api = drv8214_latency_register("bench");
+    double ns[2];
+    uint32_t (*clocks[2])() = { tick_clock, nullptr };
+    for (uint8_t c = 0; c < 2; c++) {
+        drv8214_latency_set_clock(clocks[c]);
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < BENCH_SCOPES; i++) {
+            DRV8214_LatencyScope scope(slots, depth, 0, api);
+        }
+        ns[c] = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count() / BENCH_SCOPES;
+    }
+    printf("\noverhead per call, %u calls\n", BENCH_SCOPES);
+    printf("  bookkeeping (free clock)      %6.1f ns\n", ns[0]);
+    printf("  with drv8214_time_micros()    %6.1f ns\n", ns[1]);
+
+    for (uint8_t i = 0; i < BENCH_DRIVERS; i++) {
+        delete drivers[i];
+        drv8214_sim_detach(sims[i]);
+        delete sims[i];
+    }
+    return 0;
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Worst-case control loop latency under injected bus faults. Each iteration reads the status of every driver
+// in one burst and writes a new voltage target, against simulated devices. The latency is the bus time
+// accounted by DRV8214_SimBus, so the results are deterministic and independent of the host.
+//
+// Build: g++ -O2 -Iinclude -DDRV8214_BUS_POLICY=DRV8214_SimBus -DDRV8214_LOG_MODE=DRV8214_LOG_NONE
+//            tools/drv8214_latency_bench.cpp src/*.cpp -o drv8214_latency_bench
+// Usage: drv8214_latency_bench [timeout_ms] [retries] [iterations]
+
+#include "drv8214_sim.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <vector>
+
+#define BENCH_DRIVERS 4
+
+int main(int argc, char** argv) {
+    uint16_t timeout_ms = (argc > 1) ? (uint16_t)atoi(argv[1]) : 10;
+    uint8_t  retries = (argc > 2) ? (uint8_t)atoi(argv[2]) : 2;
+    uint32_t iterations = (argc > 3) ? (uint32_t)atoi(argv[3]) : 20000;
+    drv8214_i2c_set_timeout(timeout_ms);
+    drv8214_i2c_set_retries(retries);
+
+    DRV8214Sim* sims[BENCH_DRIVERS];
+    DRV8214* drivers[BENCH_DRIVERS];
+    DRV8214_Config config;
+    config.regulation_mode = VOLTAGE;
+    for (uint8_t i = 0; i < BENCH_DRIVERS; i++) {
+        sims[i] = new DRV8214Sim(DRV8214_I2C_ADDR_00 + i);
+        drv8214_sim_attach(sims[i]);
+        drivers[i] = new DRV8214(DRV8214_I2C_ADDR_00 + i, i, 1000, 12, 5, 50, 3000);
+        drivers[i]->init(config);
+        drivers[i]->turnForward(0, 1.5f);
+    }
+
+    printf("%d drivers, timeout %u ms, %u retries, %u iterations\n", BENCH_DRIVERS, timeout_ms, retries, iterations);
+    printf("%-8s %-8s %9s %9s %9s %9s %9s %8s %8s %8s\n", "nack", "timeout", "mean_us", "p50_us", "p99_us", "p999_us", "max_us", "failed", "retries", "bound_us");
+
+    static const float rates[][2] = { {0.0f, 0.0f}, {1e-3f, 0.0f}, {1e-2f, 0.0f}, {5e-2f, 0.0f}, {0.0f, 1e-4f}, {1e-2f, 1e-3f} };
+    std::vector<uint32_t> latencies(iterations);
+    for (const auto& rate : rates) {
+        DRV8214_SimBusFaults faults;
+        faults.nack_rate = rate[0];
+        faults.timeout_rate = rate[1];
+        drv8214_sim_bus_set_faults(faults);
+        drv8214_i2c_reset_stats();
+
+        uint32_t failed = 0;
+        uint64_t total = 0;
+        for (uint32_t n = 0; n < iterations; n++) {
+            uint64_t start = drv8214_sim_bus_time_us();
+            bool ok = true;
+            for (uint8_t i = 0; i < BENCH_DRIVERS; i++) {
+                DRV8214_Status status;
+                ok &= drivers[i]->readStatus(status) == DRV8214_OK;
+                ok &= drivers[i]->setVoltageSpeed(1.0f + 0.001f * (n % 500)) == DRV8214_OK;
+            }
+            latencies[n] = (uint32_t)(drv8214_sim_bus_time_us() - start);
+            total += latencies[n];
+            if (!ok) { failed++; }
+        }
+
+        std::sort(latencies.begin(), latencies.end());
+        DRV8214_I2CStats stats;
+        drv8214_i2c_get_stats(stats);
+        // Every transfer of the iteration exhausting its budget on timeouts
+        uint64_t bound = (uint64_t)BENCH_DRIVERS * 2 * (retries + 1) * timeout_ms * 1000;
+        printf("%-8g %-8g %9.1f %9u %9u %9u %9u %8u %8u %8llu\n", rate[0], rate[1], (double)total / iterations,
+               latencies[iterations / 2], latencies[(uint64_t)iterations * 99 / 100], latencies[(uint64_t)iterations * 999 / 1000],
+               latencies[iterations - 1], failed, stats.retries, (unsigned long long)bound);
+    }
+    return 0;
+}
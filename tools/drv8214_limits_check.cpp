@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Soft limit checks against a simulated device.
+//   last ripple : from one ripple before the limit, turnXRipples(1) and turnForward() are refused and the motor does
+//                 not move (the chip cannot count a threshold of 1 ripple, it would stop one ripple past the limit)
+//   approach    : clipped moves from a few ripples before the limit end on or before it, never past it
+//   run on      : turnXRipples() with stops = false keeps running past its target and the chip stops it at the limit
+//   backlash    : after a reversal the band is crossed on top of a move that fits the limits, which bound the output
+//                 shaft: the move is neither clipped nor refused, the next one is clipped at the limit
+//   restore     : RC_HIZ and the ripple threshold the limits override are restored by brakeMotor() and by
+//                 disableSoftLimits()
+// Exits with 0 when every check passes.
+//
+// Build: g++ -O2 -Iinclude -DDRV8214_BUS_POLICY=DRV8214_SimBus -DDRV8214_LOG_MODE=DRV8214_LOG_NONE
+//            tools/drv8214_limits_check.cpp src/*.cpp -o drv8214_limits_check
+
+#include "drv8214_sim.h"
+#include <stdio.h>
+
+#define LIMIT_MAX  1000
+
+static unsigned failures = 0;
+
+static void check(bool ok, const char* what) {
+    printf("  %-66s %s\n", what, ok ? "ok" : "FAILED");
+    if (!ok) { failures++; }
+}
+
+// Lets the motor run until the chip releases the bridge, or for 2 s
+static void run(DRV8214Sim& sim, DRV8214& driver) {
+    for (uint16_t ms = 0; ms < 2000 && sim.isDriving(); ms++) { sim.step(1000); }
+    driver.updatePosition();
+}
+
+// Threshold bits as programmed: RC_THR_SCALE and RC_THR_HIGH, then RC_CTRL1
+static uint16_t threshold(DRV8214Sim& sim) {
+    return (uint16_t)(((sim.getRegister(DRV8214_RC_CTRL2) & (RC_CTRL2_RC_THR_SCALE | RC_CTRL2_RC_THR_HIGH)) << 8) | sim.getRegister(DRV8214_RC_CTRL1));
+}
+
+int main() {
+    DRV8214Sim sim(DRV8214_I2C_ADDR_00);
+    drv8214_sim_attach(&sim);
+    DRV8214 driver(DRV8214_I2C_ADDR_00, 0, 1000, 12, 5, 50, 3000);
+    DRV8214_Config config;
+    config.regulation_mode = VOLTAGE;
+    driver.init(config);
+    driver.setSoftLimits(-LIMIT_MAX, LIMIT_MAX);
+
+    printf("last ripple\n");
+    driver.setPosition(LIMIT_MAX - 1);
+    int32_t start = sim.getPosition();
+    check(driver.turnXRipples(1, true, true, 0, 2.0f) == DRV8214_ERR_LIMIT, "turnXRipples(1) at limit - 1 is refused");
+    run(sim, driver);
+    check(sim.getPosition() == start, "the motor did not move");
+    check(driver.turnForward(0, 2.0f) == DRV8214_ERR_LIMIT, "turnForward() at limit - 1 is refused");
+    run(sim, driver);
+    check(sim.getPosition() == start && driver.getPosition() == LIMIT_MAX - 1, "the motor did not move");
+    check(driver.turnReverse(0, 2.0f) == DRV8214_OK, "turnReverse() at limit - 1 is allowed");
+    driver.brakeMotor();
+
+    printf("approach\n");
+    bool never_past = true;
+    for (uint16_t room = 2; room <= 9; room++) {
+        driver.setPosition(LIMIT_MAX - room);
+        start = sim.getPosition();
+        driver.turnXRipples(room + 5, false, true, 0, 2.0f);
+        run(sim, driver);
+        never_past &= (sim.getPosition() - start <= room);
+        driver.brakeMotor();
+    }
+    check(never_past, "turnXRipples(room + 5) from 2 to 9 ripples before the limit");
+    never_past = true;
+    for (uint16_t room = 2; room <= 9; room++) {
+        driver.setPosition(LIMIT_MAX - room);
+        start = sim.getPosition();
+        driver.turnForward(0, 2.0f);
+        run(sim, driver);
+        never_past &= (sim.getPosition() - start <= room);
+        driver.brakeMotor();
+    }
+    check(never_past, "turnForward() from 2 to 9 ripples before the limit");
+
+    printf("run on\n");
+    driver.setPosition(LIMIT_MAX - 50);
+    start = sim.getPosition();
+    check(driver.turnXRipples(10, false, true, 0, 2.0f) == DRV8214_OK, "turnXRipples(10, stops = false) 50 ripples before the limit");
+    run(sim, driver);
+    check(!sim.isDriving(), "the chip released the bridge without host polling");
+    check(sim.getPosition() - start > 10 && sim.getPosition() - start <= 50, "the motor ran past its target and stopped on or before the limit");
+    driver.brakeMotor();
+
+    printf("backlash\n");
+    driver.setPosition(LIMIT_MAX - 50);
+    driver.turnXRipples(5, true, false, 0, 2.0f); // Engages the reverse flank, output and motor positions still agree
+    run(sim, driver);
+    driver.brakeMotor();
+    driver.setBacklash(20);
+    int32_t output = driver.getOutputPosition();
+    start = sim.getPosition();
+    check(driver.turnXRipples(LIMIT_MAX - output - 5, true, true, 0, 2.0f) == DRV8214_OK, "turnXRipples(room - 5) after a reversal is accepted");
+    run(sim, driver);
+    // The threshold scaling may stop a ripple early
+    check(sim.getPosition() - start >= LIMIT_MAX - output - 5 + 20 - 2, "the motor crossed the band and moved the full target");
+    check(driver.getOutputPosition() >= LIMIT_MAX - 5 - 2 && driver.getOutputPosition() <= LIMIT_MAX - 5, "the output shaft is about 5 ripples before the limit");
+    driver.brakeMotor();
+    start = sim.getPosition();
+    driver.turnXRipples(10, true, true, 0, 2.0f);
+    run(sim, driver);
+    check(sim.getPosition() - start < 10 && driver.getOutputPosition() <= LIMIT_MAX, "turnXRipples(10) is clipped at the limit");
+    driver.brakeMotor();
+    driver.setBacklash(0);
+
+    printf("restore\n");
+    driver.setPosition(0);
+    driver.setRippleCountThreshold(3000);
+    driver.setBridgeBehaviorThresholdReached(false);
+    uint16_t user_threshold = threshold(sim);
+    driver.turnForward(0, 2.0f);
+    check(sim.getRegister(DRV8214_RC_CTRL0) & RC_CTRL0_RC_HIZ, "turnForward() arms RC_HIZ at the limit");
+    driver.brakeMotor();
+    check(!(sim.getRegister(DRV8214_RC_CTRL0) & RC_CTRL0_RC_HIZ) && threshold(sim) == user_threshold, "brakeMotor() restores RC_HIZ and the threshold");
+    driver.turnReverse(0, 2.0f);
+    driver.enforceSoftLimits();
+    driver.disableSoftLimits();
+    check(!(sim.getRegister(DRV8214_RC_CTRL0) & RC_CTRL0_RC_HIZ) && threshold(sim) == user_threshold, "disableSoftLimits() during a move restores them");
+    driver.brakeMotor();
+    check(!(sim.getRegister(DRV8214_RC_CTRL0) & RC_CTRL0_RC_HIZ) && threshold(sim) == user_threshold, "brakeMotor() after disableSoftLimits() leaves them");
+
+    drv8214_sim_detach(&sim);
+    printf("\n%s\n", failures ? "FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
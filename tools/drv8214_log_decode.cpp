@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Host decoder for logs captured with DRV8214_LOG_MODE=DRV8214_LOG_BINARY.
+// Input is the raw stream of DRV8214_LogRecord structs drained with drv8214_log_drain(). Scrubber field events are
+// followed by the register and field names from drv8214_regmap.h.
+//
+// Build: g++ -O2 -Iinclude tools/drv8214_log_decode.cpp src/drv8214_log.cpp -o drv8214_log_decode
+// Usage: drv8214_log_decode [capture.bin]   (reads stdin when no file is given)
+
+#include "drv8214_log.h"
+#include "drv8214_regmap.h"
+#include <stdio.h>
+
+// "REG.FIELD" of a SCRUB_FIELD event, "REG" for the bits outside any named field
+static void print_field(const DRV8214_LogRecord& record) {
+    if (record.argc < 2) { return; }
+    const char* reg = "?";
+    for (const DRV8214_RegisterDesc& desc : DRV8214_REGISTER_TABLE) {
+        if (desc.address == record.args[1]) { reg = desc.name; }
+    }
+    if (record.args[0] < DRV8214_FIELD_TABLE_SIZE) { printf("  (%s.%s)\n", reg, DRV8214_FIELD_TABLE[record.args[0]].name); }
+    else { printf("  (%s, bits outside the named fields)\n", reg); }
+}
+
+int main(int argc, char** argv) {
+    FILE* input = stdin;
+    if (argc > 1) {
+        input = fopen(argv[1], "rb");
+        if (!input) {
+            fprintf(stderr, "Cannot open %s\n", argv[1]);
+            return 1;
+        }
+    }
+
+    DRV8214_LogRecord record;
+    char text[256];
+    unsigned long count = 0;
+    while (fread(&record, sizeof(record), 1, input) == 1) {
+        drv8214_log_decode(record, text, sizeof(text));
+        printf("[%10u us] driver %u: %s", (unsigned)record.timestamp_us, (unsigned)record.driver_id, text);
+        size_t len = strlen(text);
+        if (len == 0 || text[len - 1] != '\n') { printf("\n"); }
+        if (record.event == DRV8214_EV_SCRUB_FIELD) { print_field(record); }
+        count++;
+    }
+    fprintf(stderr, "%lu records decoded\n", count);
+
+    if (input != stdin) { fclose(input); }
+    return 0;
+}
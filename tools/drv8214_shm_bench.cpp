@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Shared-memory status ring throughput with 1 to 8 concurrent readers. The publisher writes records as fast as it
+// can, then at a fixed rate. Each reader maps the file on its own, as a separate process would, and follows it with
+// peek() / consume().
+// Every field of a record is derived from its sequence number, so a reader checks each record it accepts: a torn
+// record accepted by consume() would show up as an error. Records lost by readers that fell a lap behind are counted.
+//
+// Build: g++ -O2 -pthread -Iinclude tools/drv8214_shm_bench.cpp src/drv8214_shm.cpp -o drv8214_shm_bench
+// Usage: drv8214_shm_bench [ring file]   (default /dev/shm/drv8214_shm_bench)
+
+#include "drv8214_shm.h"
+#include <stdio.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#define BENCH_RECORDS   10000000ull
+#define BENCH_RATE      2000000     // Paced runs, far above what an I2C bus delivers
+#define BENCH_CAPACITY  65536
+
+struct ReaderResult {
+    uint64_t received = 0;
+    uint64_t lost = 0;
+    uint64_t errors = 0;     // Accepted records whose content does not match their sequence
+};
+
+static void fill(uint64_t n, uint8_t& driver_id, DRV8214_Status& status, int32_t& position, uint32_t& timestamp_us) {
+    driver_id           = (uint8_t)(n & 7);
+    status.fault        = (uint8_t)(n >> 8);
+    status.speed        = (uint8_t)(n >> 3);
+    status.ripple_count = (uint16_t)n;
+    status.voltage      = (uint8_t)(n >> 16);
+    status.current      = (uint8_t)(n >> 24);
+    status.duty         = (uint8_t)(n & 0x3F);
+    position            = (int32_t)(n * 7);
+    timestamp_us        = (uint32_t)n;
+}
+
+static bool matches(const DRV8214_ShmRecord& record, uint64_t n) {
+    uint8_t driver_id;
+    DRV8214_Status status;
+    int32_t position;
+    uint32_t timestamp_us;
+    fill(n, driver_id, status, position, timestamp_us);
+    return record.driver_id == driver_id && record.timestamp_us == timestamp_us && record.position == position &&
+           record.status.fault == status.fault && record.status.speed == status.speed && record.status.ripple_count == status.ripple_count &&
+           record.status.voltage == status.voltage && record.status.current == status.current && record.status.duty == status.duty;
+}
+
+// rate: records per second, published in batches of 1000, 0 for as fast as possible
+static void run(const char* path, uint8_t reader_count, uint32_t rate) {
+    DRV8214ShmPublisher publisher;
+    if (!publisher.open(path, BENCH_CAPACITY)) {
+        perror(path);
+        return;
+    }
+
+    std::atomic<bool> done(false);
+    std::atomic<uint8_t> ready(0);
+    std::vector<ReaderResult> results(reader_count);
+    std::vector<std::thread> threads;
+    for (uint8_t r = 0; r < reader_count; r++) {
+        threads.push_back(std::thread([&, r]() {
+            DRV8214ShmReader reader;
+            if (!reader.open(path)) { perror(path); }
+            ready++;
+            ReaderResult& result = results[r];
+            for (;;) {
+                const DRV8214_ShmRecord* record = reader.peek();
+                if (!record) {
+                    if (done && reader.getAvailable() == 0) { break; }
+                    std::this_thread::yield(); // Lets the publisher run when readers outnumber the cores
+                    continue;
+                }
+                uint64_t n = reader.getNext();
+                bool valid = matches(*record, n);
+                if (reader.consume()) {
+                    result.received++;
+                    if (!valid) { result.errors++; }
+                }
+            }
+            result.lost = reader.getLost();
+        }));
+    }
+    while (ready < reader_count) { std::this_thread::yield(); }
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t n = 0; n < BENCH_RECORDS; n++) {
+        uint8_t driver_id;
+        DRV8214_Status status;
+        int32_t position;
+        uint32_t timestamp_us;
+        fill(n, driver_id, status, position, timestamp_us);
+        publisher.publish(driver_id, status, position, timestamp_us);
+        if (rate && (n + 1) % 1000 == 0) { std::this_thread::sleep_until(start + std::chrono::microseconds((n + 1) * 1000000ull / rate)); }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    done = true;
+    for (std::thread& thread : threads) { thread.join(); }
+
+    uint64_t received = 0, lost = 0, errors = 0;
+    for (const ReaderResult& result : results) {
+        received += result.received;
+        lost += result.lost;
+        errors += result.errors;
+    }
+    printf("%7u %14.1f %14.1f %11.3f%% %8lu  %s\n", reader_count, BENCH_RECORDS / seconds / 1e6, received / seconds / 1e6,
+           100.0 * lost / ((double)BENCH_RECORDS * reader_count), (unsigned long)errors,
+           (errors == 0 && received + lost == BENCH_RECORDS * reader_count) ? "ok" : "FAILED");
+    publisher.close();
+}
+
+int main(int argc, char** argv) {
+    const char* path = (argc > 1) ? argv[1] : "/dev/shm/drv8214_shm_bench";
+    printf("%llu records, ring of %u records, %ld cores\n\n", BENCH_RECORDS, BENCH_CAPACITY, sysconf(_SC_NPROCESSORS_ONLN));
+    const uint8_t counts[] = { 1, 2, 4, 8 };
+    const uint32_t rates[] = { 0, BENCH_RATE };
+    for (uint32_t rate : rates) {
+        if (rate) { printf("\npublisher paced at %.1f M records/s\n", rate / 1e6); } else { printf("publisher as fast as possible\n"); }
+        printf("%7s %14s %14s %12s %8s\n", "readers", "publish_M/s", "delivered_M/s", "lost", "errors");
+        for (uint8_t count : counts) { run(path, count, rate); }
+    }
+    unlink(path);
+    return 0;
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Telemetry log size and cost: 8 drivers polled at 1 kHz for 60 s, logged as snprintf CSV rows and with
+// DRV8214TelemetryWriter. The status traces are synthetic but shaped like real ones: poll jitter, moves with
+// acceleration and cruise phases, idle periods, noisy voltage and current readings, occasional faults.
+// The binary stream is decoded and converted back to CSV, which must match the snprintf CSV byte for byte.
+// The size ratio is reported against the 10x target: the default 64-sample blocks reach 9.7x, 128-sample blocks
+// (-DDRV8214_TELEMETRY_BLOCK=128, twice the writer RAM) reach 10.1x.
+//
+// Build: g++ -O2 -Iinclude tools/drv8214_telemetry_bench.cpp src/drv8214_telemetry.cpp -o drv8214_telemetry_bench
+// Usage: drv8214_telemetry_bench [capture.bin]   (also writes the binary stream for drv8214_telemetry_convert)
+
+#include "drv8214_telemetry.h"
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+#define BENCH_DRIVERS     8
+#define BENCH_PERIOD_US   1000
+#define BENCH_SECONDS     60
+#define BENCH_SIZE_TARGET 10.0    // CSV bytes per binary byte
+
+struct Sample {
+    uint8_t        driver;
+    uint32_t       timestamp_us;
+    DRV8214_Status status;
+};
+
+static uint32_t rng_state = 12345;
+static uint32_t next_random() {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return rng_state >> 8;
+}
+static int32_t noise(int32_t amplitude) { return (int32_t)(next_random() % (2 * amplitude + 1)) - amplitude; }
+static uint8_t clamp_byte(int32_t value) { return (uint8_t)(value < 0 ? 0 : (value > 255 ? 255 : value)); }
+
+// Samples in poll order, the drivers interleaved like on a shared bus
+static void generate(std::vector<Sample>& samples) {
+    struct Motor { float speed, target, ripples; uint32_t phase_end; uint8_t fault; } motors[BENCH_DRIVERS] = {};
+    const uint32_t polls = BENCH_SECONDS * 1000000u / BENCH_PERIOD_US;
+    for (uint32_t poll = 0; poll < polls; poll++) {
+        for (uint8_t d = 0; d < BENCH_DRIVERS; d++) {
+            Motor& m = motors[d];
+            if (poll >= m.phase_end) { // Next move or pause, 0.2 to 2 s long
+                m.target = (next_random() % 3) ? (float)(40 + next_random() % 180) : 0.0f;
+                m.phase_end = poll + 200 + next_random() % 1800;
+            }
+            m.speed += (m.target - m.speed) * 0.01f;       // First-order acceleration
+            m.ripples += m.speed * 0.05f;                   // Ripples per poll period
+            if (next_random() % 20000 == 0) { m.fault = FAULT_STALL; } else if (next_random() % 500 == 0) { m.fault = 0; }
+
+            Sample s;
+            s.driver = d;
+            s.timestamp_us = 1000000u + poll * BENCH_PERIOD_US + d * 40 + (next_random() % 4); // Poll jitter of a few us
+            bool moving = m.speed > 1.0f;
+            s.status.fault        = m.fault;
+            s.status.speed        = clamp_byte((int32_t)m.speed + (moving ? noise(1) : 0));
+            s.status.ripple_count = (uint16_t)(int32_t)m.ripples;
+            s.status.voltage      = clamp_byte((int32_t)(m.speed * 0.8f) + (moving ? noise(1) : 0));
+            s.status.current      = clamp_byte((moving ? 60 : 0) + (int32_t)(m.speed * 0.2f) + (moving ? noise(3) : 0));
+            s.status.duty         = (uint8_t)((int32_t)(m.speed * 63.0f / 255.0f) & 0x3F);
+            samples.push_back(s);
+        }
+    }
+}
+
+static void append_sink(const uint8_t* data, uint16_t length, void* context) {
+    std::vector<uint8_t>* stream = (std::vector<uint8_t>*)context;
+    stream->insert(stream->end(), data, data + length);
+}
+
+static double elapsed_ns(std::chrono::steady_clock::time_point start) {
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+    std::vector<Sample> samples;
+    generate(samples);
+
+    // Current practice: one snprintf row per sample
+    std::vector<char> csv(samples.size() * DRV8214_TELEMETRY_CSV_MAX_ROW + sizeof(DRV8214_TELEMETRY_CSV_HEADER));
+    size_t csv_length = 0;
+    auto start = std::chrono::steady_clock::now();
+    csv_length += snprintf(&csv[0], csv.size(), "%s", DRV8214_TELEMETRY_CSV_HEADER);
+    for (const Sample& s : samples) {
+        csv_length += snprintf(&csv[csv_length], csv.size() - csv_length, "%u,%u,%u,%u,%u,%u,%u,%u\n", (unsigned)s.timestamp_us,
+                               s.driver, s.status.fault, s.status.ripple_count, s.status.speed, s.status.voltage, s.status.current,
+                               s.status.duty);
+    }
+    double csv_ns = elapsed_ns(start);
+
+    // Binary stream, one writer per driver
+    std::vector<uint8_t> stream;
+    stream.reserve(samples.size() * 4);
+    std::vector<DRV8214TelemetryWriter> writers;
+    for (uint8_t d = 0; d < BENCH_DRIVERS; d++) { writers.push_back(DRV8214TelemetryWriter(d, append_sink, &stream)); }
+    start = std::chrono::steady_clock::now();
+    uint8_t header[DRV8214_TELEMETRY_HEADER_BYTES];
+    append_sink(header, drv8214_telemetry_header(header), &stream);
+    for (const Sample& s : samples) { writers[s.driver].add(s.status, s.timestamp_us); }
+    for (DRV8214TelemetryWriter& writer : writers) { writer.flush(); }
+    double binary_ns = elapsed_ns(start);
+
+    // Round trip: decode, then rows of each driver in timestamp order, which is the poll order
+    start = std::chrono::steady_clock::now();
+    std::vector<DRV8214_TelemetryBlock> blocks;
+    size_t offset = DRV8214_TELEMETRY_HEADER_BYTES;
+    bool ok = drv8214_telemetry_check_header(stream.data(), stream.size());
+    while (ok && offset < stream.size()) {
+        blocks.push_back(DRV8214_TelemetryBlock());
+        size_t consumed = drv8214_telemetry_decode_block(&stream[offset], stream.size() - offset, blocks.back());
+        ok = consumed > 0;
+        offset += consumed;
+    }
+    double decode_ns = elapsed_ns(start);
+
+    std::vector<size_t> next_block(BENCH_DRIVERS, 0), next_sample(BENCH_DRIVERS, 0);
+    std::vector<char> rows(csv.size());
+    size_t rows_length = snprintf(&rows[0], rows.size(), "%s", DRV8214_TELEMETRY_CSV_HEADER);
+    for (size_t i = 0; ok && i < samples.size(); i++) {
+        uint8_t d = samples[i].driver;
+        while (next_block[d] < blocks.size() && (blocks[next_block[d]].driver_id != d || next_sample[d] >= blocks[next_block[d]].count)) {
+            if (blocks[next_block[d]].driver_id == d) { next_sample[d] = 0; }
+            next_block[d]++;
+        }
+        ok = next_block[d] < blocks.size();
+        if (ok) { rows_length += drv8214_telemetry_format_csv(blocks[next_block[d]], (uint8_t)next_sample[d]++, &rows[rows_length], rows.size() - rows_length); }
+    }
+    ok = ok && rows_length == csv_length && memcmp(&rows[0], &csv[0], csv_length) == 0;
+
+    double n = (double)samples.size();
+    printf("%lu samples, %u drivers, block of %u samples\n\n", (unsigned long)samples.size(), BENCH_DRIVERS, DRV8214_TELEMETRY_BLOCK);
+    printf("%-14s %12s %14s %12s\n", "format", "bytes", "bytes/sample", "ns/sample");
+    printf("%-14s %12lu %14.2f %12.1f\n", "csv", (unsigned long)csv_length, csv_length / n, csv_ns / n);
+    printf("%-14s %12lu %14.2f %12.1f\n", "binary", (unsigned long)stream.size(), stream.size() / n, binary_ns / n);
+    double ratio = (double)csv_length / stream.size();
+    printf("\nsize ratio %.2fx (target %.0fx %s), decode %.1f ns/sample, round trip %s\n", ratio, BENCH_SIZE_TARGET,
+           ratio >= BENCH_SIZE_TARGET ? "met" : "missed", decode_ns / n, ok ? "ok" : "MISMATCH");
+
+    if (argc > 1) {
+        FILE* output = fopen(argv[1], "wb");
+        if (output) {
+            fwrite(stream.data(), 1, stream.size(), output);
+            fclose(output);
+        }
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Host converter for telemetry streams written with DRV8214TelemetryWriter (drv8214_telemetry.h), to CSV.
+// The whole capture is read in memory, rows are formatted without snprintf and written in large chunks.
+//
+// Build: g++ -O2 -Iinclude tools/drv8214_telemetry_convert.cpp src/drv8214_telemetry.cpp -o drv8214_telemetry_convert
+// Usage: drv8214_telemetry_convert [capture.bin [output.csv]]   (stdin and stdout by default)
+
+#include "drv8214_telemetry.h"
+#include <stdio.h>
+#include <vector>
+
+int main(int argc, char** argv) {
+    FILE* input = stdin;
+    FILE* output = stdout;
+    if (argc > 1 && !(input = fopen(argv[1], "rb"))) {
+        fprintf(stderr, "Cannot open %s\n", argv[1]);
+        return 1;
+    }
+    if (argc > 2 && !(output = fopen(argv[2], "wb"))) {
+        fprintf(stderr, "Cannot create %s\n", argv[2]);
+        return 1;
+    }
+
+    std::vector<uint8_t> data;
+    uint8_t chunk[65536];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), input)) > 0) { data.insert(data.end(), chunk, chunk + n); }
+    if (!drv8214_telemetry_check_header(data.data(), data.size())) {
+        fprintf(stderr, "Not a DRV8214 telemetry stream (or unsupported version)\n");
+        return 1;
+    }
+
+    static DRV8214_TelemetryBlock block;
+    static char text[65536];
+    size_t used = 0, offset = DRV8214_TELEMETRY_HEADER_BYTES;
+    unsigned long blocks = 0, samples = 0;
+    fputs(DRV8214_TELEMETRY_CSV_HEADER, output);
+    while (offset < data.size()) {
+        size_t consumed = drv8214_telemetry_decode_block(&data[offset], data.size() - offset, block);
+        if (consumed == 0) {
+            fprintf(stderr, "Malformed or truncated block at offset %lu\n", (unsigned long)offset);
+            break;
+        }
+        offset += consumed;
+        for (uint8_t i = 0; i < block.count; i++) {
+            if (sizeof(text) - used < DRV8214_TELEMETRY_CSV_MAX_ROW) {
+                fwrite(text, 1, used, output);
+                used = 0;
+            }
+            used += drv8214_telemetry_format_csv(block, i, text + used, sizeof(text) - used);
+        }
+        blocks++;
+        samples += block.count;
+    }
+    fwrite(text, 1, used, output);
+    fprintf(stderr, "%lu blocks, %lu samples decoded from %lu bytes\n", blocks, samples, (unsigned long)data.size());
+
+    if (input != stdin) { fclose(input); }
+    if (output != stdout) { fclose(output); }
+    return offset == data.size() ? 0 : 1;
+}
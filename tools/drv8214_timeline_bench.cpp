@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Timeline of nine drivers sharing one simulated bus, written as Chrome trace JSON (open it in ui.perfetto.dev or
+// chrome://tracing). init() of every driver, then a 1 ms control loop reading the status of each driver and
+// writing a new voltage target, with a move started every 10 ms and 1 % of the transfers NACKed so the retries show
+// up as jitter. The clock is the bus time accounted by DRV8214_SimBus plus the idle time between loop iterations.
+// The longest span of each call and bus operation is printed, then the cost of a scope on the host.
+//
+// Build: g++ -O2 -Iinclude -DDRV8214_TIMELINE=1 -DDRV8214_BUS_POLICY=DRV8214_SimBus -DDRV8214_LOG_MODE=DRV8214_LOG_NONE
+//            tools/drv8214_timeline_bench.cpp src/*.cpp -o drv8214_timeline_bench
+// Usage: drv8214_timeline_bench [trace.json]   (default drv8214_timeline.json)
+
+#include "drv8214_sim.h"
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#if !DRV8214_TIMELINE
+    #error "Build with -DDRV8214_TIMELINE=1"
+#endif
+
+#define BENCH_DRIVERS  9
+#define BENCH_LOOPS    60      // 1 ms iterations, fits DRV8214_TIMELINE_EVENTS
+#define BENCH_CALLS    200000
+
+static uint64_t idle_us = 0;
+static uint32_t bench_clock() { return (uint32_t)(drv8214_sim_bus_time_us() + idle_us); }
+
+static void write_file(const char* text, size_t length, void* context) {
+    fwrite(text, 1, length, (FILE*)context);
+}
+
+static double time_status_reads(DRV8214& driver) {
+    DRV8214_Status status;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < BENCH_CALLS; i++) {
+        driver.readStatus(status);
+        if (i % 1000 == 999) { drv8214_timeline_clear(); }
+    }
+    double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    return ns / BENCH_CALLS;
+}
+
+int main(int argc, char** argv) {
+    const char* path = (argc > 1) ? argv[1] : "drv8214_timeline.json";
+    DRV8214Sim* sims[BENCH_DRIVERS];
+    DRV8214* drivers[BENCH_DRIVERS];
+    DRV8214_Config config;
+    config.regulation_mode = VOLTAGE;
+
+    drv8214_timeline_start(bench_clock);
+    for (uint8_t i = 0; i < BENCH_DRIVERS; i++) {
+        sims[i] = new DRV8214Sim(DRV8214_I2C_ADDR_00 + i);
+        drv8214_sim_attach(sims[i]);
+        drivers[i] = new DRV8214(DRV8214_I2C_ADDR_00 + i, i, 1000, 12, 5, 50, 3000);
+        drivers[i]->init(config);
+    }
+
+    DRV8214_SimBusFaults faults;
+    faults.nack_rate = 0.01f;
+    drv8214_sim_bus_set_faults(faults);
+    uint64_t loop_start = bench_clock();
+    for (uint32_t n = 0; n < BENCH_LOOPS; n++) {
+        // Wait for the next millisecond, or start late when the previous iteration overran
+        uint64_t now = bench_clock();
+        uint64_t due = loop_start + (uint64_t)n * 1000;
+        if (now < due) {
+            for (DRV8214Sim* sim : sims) { sim->step((uint32_t)(due - now)); }
+            idle_us += due - now;
+        }
+        if (n % 10 == 0) { drivers[(n / 10) % BENCH_DRIVERS]->turnForward(0, 2.0f); }
+        for (uint8_t i = 0; i < BENCH_DRIVERS; i++) {
+            DRV8214_Status status;
+            drivers[i]->readStatus(status);
+            drivers[i]->setVoltageSpeed(1.0f + 0.01f * (n % 100));
+        }
+    }
+    drv8214_timeline_stop();
+    drv8214_sim_bus_set_faults(DRV8214_SimBusFaults());
+
+    FILE* output = fopen(path, "w");
+    if (!output) {
+        fprintf(stderr, "Cannot create %s\n", path);
+        return 1;
+    }
+    drv8214_timeline_dump_json(write_file, output);
+    fclose(output);
+    printf("%u drivers, %u loop iterations: %lu spans written to %s, %lu dropped\n\n", BENCH_DRIVERS, BENCH_LOOPS,
+           (unsigned long)drv8214_timeline_count(), path, (unsigned long)drv8214_timeline_dropped());
+
+    // Longest span per name, the names are static strings
+    const DRV8214_TimelineEvent* events = drv8214_timeline_events();
+    printf("%-34s %8s %8s %8s\n", "span", "count", "mean_us", "max_us");
+    for (uint32_t i = 0; i < drv8214_timeline_count(); i++) {
+        bool seen = false;
+        for (uint32_t j = 0; j < i && !seen; j++) { seen = (strcmp(events[j].name, events[i].name) == 0); }
+        if (seen) { continue; }
+        uint32_t count = 0, max_us = 0;
+        uint64_t total = 0;
+        for (uint32_t j = i; j < drv8214_timeline_count(); j++) {
+            if (strcmp(events[j].name, events[i].name) != 0) { continue; }
+            count++;
+            total += events[j].duration_us;
+            if (events[j].duration_us > max_us) { max_us = events[j].duration_us; }
+        }
+        printf("%-34s %8u %8.1f %8u\n", events[i].name, count, (double)total / count, max_us);
+    }
+
+    // Scope cost: readStatus() opens one call span and one transfer span
+    double off = time_status_reads(*drivers[0]);
+    drv8214_timeline_start();
+    double on = time_status_reads(*drivers[0]);
+    drv8214_timeline_stop();
+    printf("\nreadStatus(), %u calls\n", BENCH_CALLS);
+    printf("  timeline stopped  %8.1f ns/call\n", off);
+    printf("  recording         %8.1f ns/call (+%.1f ns for 2 spans)\n", on, on - off);
+
+    for (uint8_t i = 0; i < BENCH_DRIVERS; i++) {
+        delete drivers[i];
+        drv8214_sim_detach(sims[i]);
+        delete sims[i];
+    }
+    return 0;
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// I2C trace recorder cost and a reference capture.
+//   overhead : readStatus() against a simulated device with the trace stopped, then recording and drained every
+//              100 calls. The simulated bus costs far less than a real one, so the ratio is an upper bound.
+//              Build with -DDRV8214_I2C_TRACE=0 to compare with the hook compiled out.
+//   capture  : init(), a forward move polled every millisecond for 0.5 s, then a brake, traced on a virtual clock
+//              that also drives the simulated motor. drv8214_trace_replay replays it without a single mismatch.
+//
+// Build: g++ -O2 -Iinclude -DDRV8214_BUS_POLICY=DRV8214_SimBus -DDRV8214_LOG_MODE=DRV8214_LOG_NONE
+//            tools/drv8214_trace_bench.cpp src/*.cpp -o drv8214_trace_bench
+// Usage: drv8214_trace_bench [capture.bin]   (default drv8214_trace.bin)
+
+#include "drv8214_sim.h"
+#include <stdio.h>
+#include <chrono>
+#include <vector>
+
+#define BENCH_CALLS  200000
+
+static uint32_t virtual_us = 0;
+static uint32_t virtual_clock() { return virtual_us; }
+
+static std::vector<uint8_t> trace;
+static void drain() {
+    uint8_t chunk[DRV8214_I2C_TRACE_RING_SIZE];
+    uint32_t bytes;
+    while ((bytes = drv8214_i2c_trace_drain(chunk, sizeof(chunk))) > 0) { trace.insert(trace.end(), chunk, chunk + bytes); }
+}
+
+static double time_status_reads(DRV8214& driver, bool record, uint32_t (*clock)() = nullptr) {
+    DRV8214_Status status;
+    if (record) { drv8214_i2c_trace_start(clock); }
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < BENCH_CALLS; i++) {
+        driver.readStatus(status);
+        if (record && i % 100 == 99) {
+            trace.clear();
+            drain();
+        }
+    }
+    double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    drv8214_i2c_trace_stop();
+    return ns / BENCH_CALLS;
+}
+
+int main(int argc, char** argv) {
+    const char* path = (argc > 1) ? argv[1] : "drv8214_trace.bin";
+    DRV8214_Config config;
+
+    // Overhead
+    {
+        DRV8214Sim sim(DRV8214_I2C_ADDR_00);
+        drv8214_sim_attach(&sim);
+        DRV8214 driver(DRV8214_I2C_ADDR_00, 0, 1000, 12, 5, 50, 3000);
+        driver.init(config);
+        double off = time_status_reads(driver, false);
+        printf("readStatus(), %u calls, hook %s\n", BENCH_CALLS, DRV8214_I2C_TRACE ? "compiled in" : "compiled out");
+        printf("  trace stopped   %8.1f ns/call\n", off);
+        #if DRV8214_I2C_TRACE
+            double on = time_status_reads(driver, true);
+            double on_virtual = time_status_reads(driver, true, virtual_clock);
+            printf("  recording       %8.1f ns/call (+%.1f ns, %u bytes per record)\n", on, on - off, DRV8214_I2C_TRACE_RECORD_BYTES + 7);
+            printf("  virtual clock   %8.1f ns/call (+%.1f ns, record and drain without the platform clock read)\n", on_virtual, on_virtual - off);
+            printf("  records dropped %8u\n", (unsigned)drv8214_i2c_trace_dropped());
+        #endif
+        drv8214_sim_detach(&sim);
+    }
+
+    #if DRV8214_I2C_TRACE
+        // Capture, only with the hook compiled in
+        trace.clear();
+        uint8_t header[DRV8214_I2C_TRACE_HEADER_BYTES];
+        trace.insert(trace.end(), header, header + drv8214_i2c_trace_header(header));
+        DRV8214Sim sim(DRV8214_I2C_ADDR_01);
+        drv8214_sim_attach(&sim);
+        DRV8214 driver(DRV8214_I2C_ADDR_01, 1, 1000, 12, 5, 50, 3000);
+        drv8214_i2c_trace_start(virtual_clock);
+        driver.init(config);
+        driver.turnForward(100);
+        DRV8214_Status status;
+        for (uint16_t poll = 0; poll < 500; poll++) {
+            sim.step(1000);
+            virtual_us += 1000;
+            driver.readStatus(status);
+            driver.updatePosition(status);
+            drain();
+        }
+        driver.brakeMotor();
+        drv8214_i2c_trace_stop();
+        drain();
+        drv8214_sim_detach(&sim);
+
+        FILE* output = fopen(path, "wb");
+        if (!output) {
+            fprintf(stderr, "Cannot create %s\n", path);
+            return 1;
+        }
+        fwrite(trace.data(), 1, trace.size(), output);
+        fclose(output);
+        printf("\ncapture: %lu bytes written to %s, final position %ld ripples\n", (unsigned long)trace.size(), path, (long)driver.getPosition());
+    #else
+        (void)path; (void)virtual_clock;
+    #endif
+    return 0;
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Compares two I2C traces transaction by transaction: address, register, direction, result, retries and data.
+// Timestamps are compared only with -t, relative to the first transaction of each trace, within the given tolerance.
+// Retry counts saturate at DRV8214_I2C_TRACE_RETRIES_SATURATED in a trace: two saturated transactions compare equal
+// and are counted apart, their real retry counts may differ.
+// Exits with 0 when the traces match.
+//
+// Build: g++ -O2 -Iinclude tools/drv8214_trace_diff.cpp src/drv8214_platform_i2c.cpp src/drv8214_platform_time.cpp
+//            src/drv8214_regmap.cpp -o drv8214_trace_diff
+// Usage: drv8214_trace_diff [-t tolerance_us] a.bin b.bin
+
+#include "drv8214_platform_i2c.h"
+#include "drv8214_regmap.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#if !DRV8214_I2C_TRACE
+    #error "Build with -DDRV8214_I2C_TRACE=1"
+#endif
+
+#define DIFF_MAX_REPORTED  20  // Differences printed, all of them are counted
+
+static bool load(const char* path, std::vector<DRV8214_I2CTraceRecord>& records) {
+    FILE* input = fopen(path, "rb");
+    if (!input) {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return false;
+    }
+    std::vector<uint8_t> data;
+    uint8_t chunk[65536];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), input)) > 0) { data.insert(data.end(), chunk, chunk + n); }
+    fclose(input);
+    if (!drv8214_i2c_trace_check_header(data.data(), data.size())) {
+        fprintf(stderr, "%s is not a DRV8214 I2C trace (or unsupported version)\n", path);
+        return false;
+    }
+    size_t offset = DRV8214_I2C_TRACE_HEADER_BYTES;
+    DRV8214_I2CTraceRecord record;
+    while (offset < data.size()) {
+        size_t consumed = drv8214_i2c_trace_parse(&data[offset], data.size() - offset, record);
+        if (consumed == 0) {
+            fprintf(stderr, "%s: truncated record at offset %lu\n", path, (unsigned long)offset);
+            break;
+        }
+        records.push_back(record);
+        offset += consumed;
+    }
+    return true;
+}
+
+static bool saturated(const DRV8214_I2CTraceRecord& record) {
+    return ((record.flags & DRV8214_I2C_TRACE_RETRIES) >> 3) == DRV8214_I2C_TRACE_RETRIES_SATURATED;
+}
+
+static void print_record(char side, const DRV8214_I2CTraceRecord& record, uint32_t start) {
+    const DRV8214_RegisterDesc* desc = drv8214_regmap_register(record.reg);
+    printf("  %c %10u us  0x%02X %-5s %-11s", side, (unsigned)(record.timestamp_us - start), record.address,
+           (record.flags & DRV8214_I2C_TRACE_READ) ? "read" : "write", desc ? desc->name : "RESERVED");
+    for (uint8_t i = 0; i < record.length; i++) { printf(" %02X", record.data[i]); }
+    printf("  flags %02X", record.flags);
+    if (saturated(record)) { printf(" (retries saturated)"); }
+    printf("\n");
+}
+
+int main(int argc, char** argv) {
+    long tolerance = -1;
+    const char* paths[2] = { nullptr, nullptr };
+    uint8_t files = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) { tolerance = atol(argv[++i]); }
+        else if (files < 2) { paths[files++] = argv[i]; }
+    }
+    if (files < 2) {
+        fprintf(stderr, "Usage: drv8214_trace_diff [-t tolerance_us] a.bin b.bin\n");
+        return 2;
+    }
+    std::vector<DRV8214_I2CTraceRecord> a, b;
+    if (!load(paths[0], a) || !load(paths[1], b)) { return 2; }
+
+    uint32_t start_a = a.empty() ? 0 : a[0].timestamp_us;
+    uint32_t start_b = b.empty() ? 0 : b[0].timestamp_us;
+    size_t common = a.size() < b.size() ? a.size() : b.size();
+    unsigned long differences = 0;
+    unsigned long unknown_retries = 0;
+    for (size_t i = 0; i < common; i++) {
+        const DRV8214_I2CTraceRecord& x = a[i];
+        const DRV8214_I2CTraceRecord& y = b[i];
+        bool same = x.address == y.address && x.reg == y.reg && x.flags == y.flags && x.length == y.length &&
+                    memcmp(x.data, y.data, x.length) == 0;
+        if (same && tolerance >= 0) {
+            long skew = (long)(int32_t)((x.timestamp_us - start_a) - (y.timestamp_us - start_b));
+            same = (skew <= tolerance && -skew <= tolerance);
+        }
+        if (same) {
+            if (saturated(x)) { unknown_retries++; }
+            continue;
+        }
+        if (differences++ < DIFF_MAX_REPORTED) {
+            printf("#%lu\n", (unsigned long)i);
+            print_record('<', x, start_a);
+            print_record('>', y, start_b);
+        }
+    }
+
+    printf("%lu and %lu transactions, %lu differ", (unsigned long)a.size(), (unsigned long)b.size(), differences);
+    if (a.size() != b.size()) { printf(", %lu only in %s", (unsigned long)(a.size() > b.size() ? a.size() - common : b.size() - common), a.size() > b.size() ? paths[0] : paths[1]); }
+    printf("\n");
+    if (unknown_retries) { printf("%lu matching transactions with saturated retry counts (%u or more), not compared\n", unknown_retries, DRV8214_I2C_TRACE_RETRIES_SATURATED); }
+    return (differences == 0 && a.size() == b.size()) ? 0 : 1;
+}
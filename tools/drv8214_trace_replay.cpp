@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2025 Théo Heng
+ *
+ * This file is part of the drv8214_multiplatform library.
+ *
+ * Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+ */
+
+// Replays an I2C trace (drv8214_i2c_trace_start(), drained into a file after drv8214_i2c_trace_header()) into
+// simulated DRV8214s, one per address seen in the trace. The simulated time follows the trace timestamps, the
+// successful writes are applied, and the result of every successful read is compared with what the driver got on the
+// bus. The final register image of each device is printed at the end.
+//   -f : follow the trace, the recorded read values are loaded into the simulated registers after a mismatch, so the
+//        status registers track the real motor instead of the motor model
+//   -v : print every transaction
+//
+// Build: g++ -O2 -Iinclude -DDRV8214_BUS_POLICY=DRV8214_SimBus tools/drv8214_trace_replay.cpp src/*.cpp -o drv8214_trace_replay
+// Usage: drv8214_trace_replay [-f] [-v] trace.bin
+
+#include "drv8214_sim.h"
+#include "drv8214_regmap.h"
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#if !DRV8214_I2C_TRACE
+    #error "Build with -DDRV8214_I2C_TRACE=1"
+#endif
+
+#define REPLAY_MAX_REPORTED  20  // Mismatches printed, all of them are counted
+
+static const char* register_name(uint8_t reg) {
+    const DRV8214_RegisterDesc* desc = drv8214_regmap_register(reg);
+    return desc ? desc->name : "RESERVED";
+}
+
+static void print_line(const char* line, void*) {
+    printf("  %s", line);
+}
+
+static void print_record(unsigned long index, const DRV8214_I2CTraceRecord& record) {
+    printf("#%-7lu %10u us  0x%02X %-5s %-11s", index, (unsigned)record.timestamp_us, record.address,
+           (record.flags & DRV8214_I2C_TRACE_READ) ? "read" : "write", register_name(record.reg));
+    for (uint8_t i = 0; i < record.length; i++) { printf(" %02X", record.data[i]); }
+    uint8_t result = (record.flags & DRV8214_I2C_TRACE_RESULT) >> 1;
+    if (result != DRV8214_I2C_OK) { printf("  (failed, result %u)", result); }
+    uint8_t retries = (record.flags & DRV8214_I2C_TRACE_RETRIES) >> 3;
+    if (retries == DRV8214_I2C_TRACE_RETRIES_SATURATED) { printf("  (%u or more retries, saturated)", retries); }
+    else if (retries) { printf("  (%u retries)", retries); }
+    printf("\n");
+}
+
+int main(int argc, char** argv) {
+    bool follow = false, verbose = false;
+    const char* path = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-f") == 0) { follow = true; }
+        else if (strcmp(argv[i], "-v") == 0) { verbose = true; }
+        else { path = argv[i]; }
+    }
+    FILE* input = path ? fopen(path, "rb") : nullptr;
+    if (!input) {
+        fprintf(stderr, "Usage: drv8214_trace_replay [-f] [-v] trace.bin\n");
+        return 1;
+    }
+    std::vector<uint8_t> data;
+    uint8_t chunk[65536];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), input)) > 0) { data.insert(data.end(), chunk, chunk + n); }
+    fclose(input);
+    if (!drv8214_i2c_trace_check_header(data.data(), data.size())) {
+        fprintf(stderr, "Not a DRV8214 I2C trace (or unsupported version)\n");
+        return 1;
+    }
+
+    std::vector<DRV8214Sim*> devices;
+    unsigned long index = 0, writes = 0, reads = 0, failed = 0, mismatches = 0;
+    uint32_t last_timestamp = 0;
+    size_t offset = DRV8214_I2C_TRACE_HEADER_BYTES;
+    DRV8214_I2CTraceRecord record;
+    while (offset < data.size()) {
+        size_t consumed = drv8214_i2c_trace_parse(&data[offset], data.size() - offset, record);
+        if (consumed == 0) {
+            fprintf(stderr, "Truncated record at offset %lu\n", (unsigned long)offset);
+            break;
+        }
+        offset += consumed;
+
+        // Time elapsed since the previous transaction, for every device
+        if (index > 0) {
+            for (DRV8214Sim* device : devices) { device->step(record.timestamp_us - last_timestamp); }
+        }
+        last_timestamp = record.timestamp_us;
+
+        DRV8214Sim* device = nullptr;
+        for (DRV8214Sim* candidate : devices) { if (candidate->getAddress() == record.address) { device = candidate; } }
+        if (!device) {
+            device = new DRV8214Sim(record.address); // Starts from its power-on state
+            devices.push_back(device);
+        }
+        if (verbose) { print_record(index, record); }
+
+        bool read = (record.flags & DRV8214_I2C_TRACE_READ) != 0;
+        if ((record.flags & DRV8214_I2C_TRACE_RESULT) != (DRV8214_I2C_OK << 1)) {
+            failed++; // Whether a failed write reached the device is unknown, the data of a failed read is not the device's
+        } else if (!read) {
+            device->write(record.reg, record.data, record.length);
+            writes++;
+        } else {
+            uint8_t simulated[DRV8214_I2C_TRACE_MAX_DATA];
+            device->read(record.reg, simulated, record.length);
+            reads++;
+            for (uint8_t i = 0; i < record.length; i++) {
+                uint8_t reg = (uint8_t)(record.reg + i);
+                if (simulated[i] == record.data[i]) { continue; }
+                if (mismatches++ < REPLAY_MAX_REPORTED) {
+                    printf("#%-7lu %10u us  0x%02X %-11s trace %02X, simulator %02X\n", index, (unsigned)record.timestamp_us,
+                           record.address, register_name(reg), record.data[i], simulated[i]);
+                }
+                if (follow) { device->setRegister(reg, record.data[i]); }
+            }
+        }
+        index++;
+    }
+
+    printf("\n%lu transactions: %lu writes applied, %lu reads compared, %lu failed transfers, %lu mismatching register reads\n",
+           index, writes, reads, failed, mismatches);
+    for (DRV8214Sim* device : devices) {
+        uint8_t image[DRV8214_REG_COUNT];
+        for (uint8_t reg = 0; reg < DRV8214_REG_COUNT; reg++) { image[reg] = device->getRegister(reg); }
+        printf("\nDevice 0x%02X, final registers:\n", device->getAddress());
+        drv8214_regmap_print_dump(image, print_line, nullptr);
+        delete device;
+    }
+    return mismatches ? 1 : 0;
+}